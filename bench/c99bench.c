@@ -0,0 +1,332 @@
+/*
+ * Benchmark harness for c99conv
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Converts each file of a corpus list a number of times, and reports the
+ * median and 95th percentile wall time, the peak RSS and the throughput
+ * per file, along with the median time of each c99conv phase (from its
+ * -stats= output). Each line of the list is a file name, optionally
+ * followed by c99conv options (e.g. -ms); '#' starts a comment.
+ *
+ * With -baseline, the medians are compared against a file written by an
+ * earlier run with -save, and the exit code is 1 if any file got slower
+ * by more than -threshold percent. Linux only (wait4() for the RSS).
+ */
+
+#define _GNU_SOURCE /* wait4() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#define MAX_OPTIONS 8
+
+static const char *phase_names[] = {
+    "parse", "tokenize", "visit", "registry", "reorder", "emit",
+};
+#define N_PHASES (sizeof(phase_names) / sizeof(phase_names[0]))
+
+typedef struct {
+    char *file;
+    char *options[MAX_OPTIONS];
+    int n_options;
+    double *wall, *phases[N_PHASES];
+    int n_runs;
+    long rss_kb;     /* peak */
+    unsigned tokens; /* from the last run */
+    int failed;
+} Entry;
+
+static double get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double da = *(const double *) a, db = *(const double *) b;
+
+    return da < db ? -1 : da > db;
+}
+
+/* Sorts v, and returns the value at fraction q of it */
+static double percentile(double *v, int n, double q)
+{
+    int idx;
+
+    if (!n)
+        return 0.0;
+    qsort(v, n, sizeof(*v), compare_doubles);
+    idx = (int) (q * (n - 1) + 0.5);
+    return v[idx];
+}
+
+static char *read_file(const char *name)
+{
+    FILE *f = fopen(name, "rb");
+    char *buf;
+    long len;
+
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(len + 1);
+    if (!buf || fread(buf, 1, len, f) != (size_t) len) {
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    buf[len] = 0;
+    fclose(f);
+
+    return buf;
+}
+
+/* The number after "key": in the JSON object json, or -1 */
+static double json_number(const char *json, const char *key)
+{
+    char pattern[64];
+    const char *p;
+
+    snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+    p = strstr(json, pattern);
+    return p ? strtod(p + strlen(pattern), NULL) : -1.0;
+}
+
+static int read_list(const char *name, Entry **entries)
+{
+    FILE *f = fopen(name, "r");
+    char line[4096];
+    int n = 0, allocated = 0;
+
+    if (!f) {
+        fprintf(stderr, "Unable to open corpus list %s\n", name);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), f)) {
+        char *tok, *save;
+        Entry *e;
+
+        if ((tok = strchr(line, '#')))
+            *tok = 0;
+        tok = strtok_r(line, " \t\r\n", &save);
+        if (!tok)
+            continue;
+        if (n == allocated) {
+            allocated = allocated * 2 + 16;
+            *entries = realloc(*entries, allocated * sizeof(**entries));
+            if (!*entries) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+        e = &(*entries)[n++];
+        memset(e, 0, sizeof(*e));
+        e->file = strdup(tok);
+        while ((tok = strtok_r(NULL, " \t\r\n", &save)) &&
+               e->n_options < MAX_OPTIONS)
+            e->options[e->n_options++] = strdup(tok);
+    }
+    fclose(f);
+
+    return n;
+}
+
+/* Runs c99conv once on e, and adds the run's results to it */
+static void run_entry(Entry *e, const char *conv, const char *stats_file,
+                      const char *out_file)
+{
+    char stats_option[4096], *argv[MAX_OPTIONS + 5], *json;
+    struct rusage ru;
+    double t0, t1;
+    int argc = 0, status, n;
+    pid_t pid;
+
+    snprintf(stats_option, sizeof(stats_option), "-stats=%s", stats_file);
+    argv[argc++] = (char *) conv;
+    for (n = 0; n < e->n_options; n++)
+        argv[argc++] = e->options[n];
+    argv[argc++] = stats_option;
+    argv[argc++] = e->file;
+    argv[argc++] = (char *) out_file;
+    argv[argc] = NULL;
+    unlink(stats_file);
+
+    t0 = get_time();
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (!pid) {
+        execv(conv, argv);
+        perror(conv);
+        _exit(127);
+    }
+    if (wait4(pid, &status, 0, &ru) < 0) {
+        perror("wait4");
+        exit(1);
+    }
+    t1 = get_time();
+
+    json = read_file(stats_file);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) || !json) {
+        e->failed = 1;
+        free(json);
+        return;
+    }
+    e->wall[e->n_runs] = t1 - t0;
+    for (n = 0; n < (int) N_PHASES; n++)
+        e->phases[n][e->n_runs] = json_number(json, phase_names[n]) / 1000.0;
+    e->tokens = (unsigned) json_number(json, "tokens");
+    if (ru.ru_maxrss > e->rss_kb)
+        e->rss_kb = ru.ru_maxrss;
+    e->n_runs++;
+    free(json);
+}
+
+/* Median in ms of the file in the baseline, or a negative value */
+static double baseline_median(const char *baseline, const char *file)
+{
+    const char *p = baseline;
+    size_t len = strlen(file);
+
+    while (p && *p) {
+        if (!strncmp(p, file, len) && p[len] == ' ')
+            return strtod(p + len + 1, NULL);
+        p = strchr(p, '\n');
+        if (p)
+            p++;
+    }
+
+    return -1.0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *conv = "./c99conv", *baseline_file = NULL, *save_file = NULL;
+    char stats_file[64], out_file[64], *baseline = NULL;
+    double threshold = 10.0;
+    int runs = 10, n_entries, i, n, regressions = 0, failures = 0;
+    Entry *entries = NULL;
+    FILE *save = NULL;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-runs"))
+            runs = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-conv"))
+            conv = argv[i + 1];
+        else if (!strcmp(argv[i], "-baseline"))
+            baseline_file = argv[i + 1];
+        else if (!strcmp(argv[i], "-threshold"))
+            threshold = atof(argv[i + 1]);
+        else if (!strcmp(argv[i], "-save"))
+            save_file = argv[i + 1];
+        else
+            break;
+    }
+    if (i + 1 != argc || runs < 1) {
+        fprintf(stderr, "%s [-runs N] [-conv c99conv] [-baseline file] "
+                "[-threshold percent] [-save file] <corpus list>\n", argv[0]);
+        return 1;
+    }
+    n_entries = read_list(argv[i], &entries);
+    if (baseline_file && !(baseline = read_file(baseline_file)))
+        fprintf(stderr, "No baseline in %s, not comparing\n", baseline_file);
+    if (save_file && !(save = fopen(save_file, "w"))) {
+        fprintf(stderr, "Unable to write %s\n", save_file);
+        return 1;
+    }
+    snprintf(stats_file, sizeof(stats_file), "/tmp/c99bench_%d.json",
+             (int) getpid());
+    snprintf(out_file, sizeof(out_file), "/tmp/c99bench_%d.c", (int) getpid());
+
+    printf("%-40s %9s %9s %9s %8s", "file", "median ms", "p95 ms",
+           "RSS KiB", "Mtok/s");
+    for (n = 0; n < (int) N_PHASES; n++)
+        printf(" %9s", phase_names[n]);
+    printf("\n%-40s %9s %9s %9s %8s %s\n", "", "", "", "", "",
+           "(median ms, then tokens per second of each phase)");
+
+    for (i = 0; i < n_entries; i++) {
+        Entry *e = &entries[i];
+        double median, p95, base, phase_median[N_PHASES];
+
+        e->wall = calloc(runs, sizeof(*e->wall));
+        for (n = 0; n < (int) N_PHASES; n++)
+            e->phases[n] = calloc(runs, sizeof(*e->phases[n]));
+        for (n = 0; n < runs && !e->failed; n++)
+            run_entry(e, conv, stats_file, out_file);
+        if (e->failed) {
+            printf("%-40s FAILED\n", e->file);
+            failures++;
+            continue;
+        }
+
+        median = percentile(e->wall, e->n_runs, 0.5);
+        p95 = percentile(e->wall, e->n_runs, 0.95);
+        printf("%-40s %9.2f %9.2f %9ld %8.3f", e->file, median * 1000.0,
+               p95 * 1000.0, e->rss_kb, e->tokens / median / 1e6);
+        for (n = 0; n < (int) N_PHASES; n++) {
+            phase_median[n] = percentile(e->phases[n], e->n_runs, 0.5);
+            printf(" %9.2f", phase_median[n] * 1000.0);
+        }
+
+        base = baseline ? baseline_median(baseline, e->file) : -1.0;
+        if (base > 0) {
+            double change = (median * 1000.0 / base - 1.0) * 100.0;
+            printf("  %+.1f%%", change);
+            if (change > threshold) {
+                printf(" REGRESSION");
+                regressions++;
+            }
+        }
+        printf("\n%-40s %9s %9s %9s %8s", "", "", "", "", "Mtok/s");
+        for (n = 0; n < (int) N_PHASES; n++) {
+            if (phase_median[n] > 0)
+                printf(" %9.2f", e->tokens / phase_median[n] / 1e6);
+            else
+                printf(" %9s", "-");
+        }
+        printf("\n");
+        if (save)
+            fprintf(save, "%s %.3f %.3f %ld\n", e->file, median * 1000.0,
+                    p95 * 1000.0, e->rss_kb);
+    }
+    unlink(stats_file);
+    unlink(out_file);
+    if (save)
+        fclose(save);
+
+    if (failures)
+        printf("%d of %d files failed to convert\n", failures, n_entries);
+    if (regressions) {
+        printf("%d files slower than the baseline by more than %.1f%%\n",
+               regressions, threshold);
+        return 1;
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,505 @@
+/*
+ * Worst-case input fuzzer for c99conv
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Runs convert() in-process on each input and scores it by wall time per
+ * input byte (minus the time taken on an empty file). The slowest inputs
+ * are kept in a directory as slow_<n>.c, along with a corpus.txt that
+ * c99bench runs them from.
+ *
+ * The correctness oracle is that any input the oracle compiler accepts as
+ * C99 (-std=c99 -pedantic-errors) must convert to output it accepts as C89
+ * (-std=c89 -pedantic-errors). Inputs that fail it are saved as
+ * c89fail_<n>.c. The compiler is C99_TO_C89_FUZZ_CC (default clang), and
+ * an empty value disables the oracle. The input being converted is kept
+ * as current.c, so that it is left behind if convert() crashes.
+ *
+ * Standalone, the inputs are either the files on the command line, or
+ * generated from a small grammar of the constructs that combine badly:
+ * arrays of structs with unions, nested compound literals in for loop
+ * initializers, and long if/else if ladders with mixed declarations.
+ * -corpus writes generated inputs to a directory instead, as seeds for
+ * the libFuzzer build (-DC99FUZZ_LIBFUZZER -fsanitize=fuzzer), which
+ * reads the output directory from C99_TO_C89_FUZZ_SAVE_DIR.
+ */
+
+#define C99CONV_NO_MAIN
+#include "../convert.c"
+
+#include <stdarg.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#define MAX_KEEP 64
+#define MIN_SCORED_SIZE 64
+
+typedef struct {
+    double score; // seconds per byte
+    double time;
+    size_t size;
+} SlowInput;
+
+static const char *save_dir = "bench/slow";
+static const char *oracle_cc = "clang";
+static char fuzz_in[4096], fuzz_out[64];
+static ConvertOptions fuzz_opts;
+static double empty_time;
+static SlowInput slowest[MAX_KEEP];
+static int n_keep = 8, n_oracle_failures, n_conversion_failures;
+
+static int write_whole_file(const char *name, const uint8_t *data, size_t size)
+{
+    FILE *f = fopen(name, "wb");
+    int res = !f || fwrite(data, 1, size, f) != size;
+
+    if (f && fclose(f))
+        res = 1;
+    if (res)
+        fprintf(stderr, "Unable to write %s\n", name);
+
+    return res;
+}
+
+/* Runs oracle_cc on file in the given -std mode, returns 1 if it is valid */
+static int oracle_accepts(const char *std, const char *file)
+{
+    char *argv[] = { (char *) oracle_cc, (char *) std, "-pedantic-errors",
+                     "-fsyntax-only", (char *) file, NULL };
+    int status;
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (!pid) {
+        int fd = open("/dev/null", O_WRONLY);
+        if (fd >= 0) {
+            dup2(fd, 1);
+            dup2(fd, 2);
+        }
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    if (waitpid(pid, &status, 0) < 0) {
+        perror("waitpid");
+        exit(1);
+    }
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 127) {
+        fprintf(stderr, "Unable to run %s, disabling the oracle\n", oracle_cc);
+        oracle_cc = NULL;
+        return 1;
+    }
+
+    return WIFEXITED(status) && !WEXITSTATUS(status);
+}
+
+/* Keeps the input in the save directory if it is among the slowest */
+static void record_time(const uint8_t *data, size_t size, double t)
+{
+    double score = (t - empty_time) / size;
+    char name[4096];
+    int n, slot = 0;
+
+    if (size < MIN_SCORED_SIZE)
+        return;
+    for (n = 1; n < n_keep; n++) {
+        if (slowest[n].score < slowest[slot].score)
+            slot = n;
+    }
+    if (score <= slowest[slot].score)
+        return;
+
+    snprintf(name, sizeof(name), "%s/slow_%d.c", save_dir, slot);
+    if (write_whole_file(name, data, size))
+        return;
+    slowest[slot].score = score;
+    slowest[slot].time = t;
+    slowest[slot].size = size;
+    fprintf(stderr, "%s: %u bytes in %.3f ms (%.3f us/byte)\n", name,
+            (unsigned) size, t * 1000.0, score * 1000000.0);
+
+    snprintf(name, sizeof(name), "%s/corpus.txt", save_dir);
+    FILE *f = fopen(name, "w");
+    if (!f)
+        return;
+    for (n = 0; n < n_keep; n++) {
+        if (slowest[n].size)
+            fprintf(f, "%s/slow_%d.c # %.3f us/byte\n", save_dir, n,
+                    slowest[n].score * 1000000.0);
+    }
+    fclose(f);
+}
+
+/* Converts one input and checks the oracle, returns 0 if all went well */
+static int run_input(const uint8_t *data, size_t size)
+{
+    double t0, t;
+    int res, valid;
+
+    if (write_whole_file(fuzz_in, data, size))
+        return 1;
+    t0 = get_time();
+    res = convert(fuzz_in, fuzz_out, &fuzz_opts);
+    t = get_time() - t0;
+    record_time(data, size, t);
+
+    valid = oracle_cc && oracle_accepts("-std=c99", fuzz_in);
+    if (valid && !res && oracle_cc && !oracle_accepts("-std=c89", fuzz_out)) {
+        char name[4096];
+
+        snprintf(name, sizeof(name), "%s/c89fail_%d.c", save_dir,
+                 n_oracle_failures++);
+        fprintf(stderr, "%s: output is not valid C89\n", name);
+        write_whole_file(name, data, size);
+        return 1;
+    } else if (valid && res) {
+        n_conversion_failures++;
+        return 1;
+    }
+
+    return 0;
+}
+
+static void fuzz_init(void)
+{
+    const char *env;
+
+    memset(&fuzz_opts, 0, sizeof(fuzz_opts));
+    fuzz_opts.n_threads = 1;
+    fuzz_opts.rewrites = REWRITE_ALL;
+    fuzz_opts.target = "i386-pc-win32";
+    // with C99_TO_C89_CONV_TRACE, a crash in convert() leaves a trace
+    trace_init();
+    if ((env = getenv("C99_TO_C89_FUZZ_CC")))
+        oracle_cc = env[0] ? env : NULL;
+    if ((env = getenv("C99_TO_C89_FUZZ_SAVE_DIR")) && env[0])
+        save_dir = env;
+    mkdir(save_dir, 0777);
+    snprintf(fuzz_in, sizeof(fuzz_in), "%s/current.c", save_dir);
+    snprintf(fuzz_out, sizeof(fuzz_out), "/tmp/c99fuzz_%d.o.c",
+             (int) getpid());
+
+    double t0 = get_time();
+    write_whole_file(fuzz_in, (const uint8_t *) "", 0);
+    convert(fuzz_in, fuzz_out, &fuzz_opts);
+    empty_time = get_time() - t0;
+}
+
+#if defined(C99FUZZ_LIBFUZZER)
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    fuzz_init();
+    return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (run_input(data, size) && n_oracle_failures)
+        abort(); // so that libFuzzer reports it too
+    return 0;
+}
+#else
+typedef struct {
+    char *data;
+    size_t len, allocated;
+} GenBuffer;
+
+static GenBuffer gen_buf;
+static uint64_t gen_state;
+static unsigned gen_max_len = 4096, gen_vars;
+
+/* xorshift64 */
+static unsigned gen_rand(unsigned range)
+{
+    gen_state ^= gen_state << 13;
+    gen_state ^= gen_state >> 7;
+    gen_state ^= gen_state << 17;
+    return (unsigned) (gen_state % range);
+}
+
+static void gen_printf(const char *fmt, ...)
+{
+    va_list ap;
+    int len;
+
+    va_start(ap, fmt);
+    len = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    if (gen_buf.len + len + 1 > gen_buf.allocated) {
+        gen_buf.allocated = (gen_buf.len + len + 1) * 2;
+        gen_buf.data = realloc(gen_buf.data, gen_buf.allocated);
+        if (!gen_buf.data) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    va_start(ap, fmt);
+    vsnprintf(gen_buf.data + gen_buf.len, len + 1, fmt, ap);
+    va_end(ap);
+    gen_buf.len += len;
+}
+
+/* Only refers to the parameter and sum, which are always in scope */
+static void gen_expr(int depth)
+{
+    switch (depth > 3 ? gen_rand(2) : gen_rand(6)) {
+    case 0:
+        gen_printf("%u", gen_rand(100));
+        break;
+    case 1:
+        gen_printf("%s", gen_rand(2) ? "sum" : "v");
+        break;
+    case 2:
+        gen_printf("use_inner((Inner) { .y = ");
+        gen_expr(depth + 1);
+        gen_printf(", .x = ");
+        gen_expr(depth + 1);
+        gen_printf(" })");
+        break;
+    case 3:
+        gen_printf("use_item((Item) { .v.in = (Inner) { ");
+        gen_expr(depth + 1);
+        gen_printf(", %u }, .kind = ", gen_rand(4));
+        gen_expr(depth + 1);
+        gen_printf(" })");
+        break;
+    case 4:
+        gen_printf("((const int[]) { ");
+        gen_expr(depth + 1);
+        gen_printf(", %u })[sum & 1]", gen_rand(10));
+        break;
+    default:
+        gen_printf("(");
+        gen_expr(depth + 1);
+        gen_printf(" + ");
+        gen_expr(depth + 1);
+        gen_printf(")");
+        break;
+    }
+}
+
+static void gen_block(int depth);
+
+static void gen_decl(int depth)
+{
+    unsigned k = gen_vars++;
+
+    switch (gen_rand(3)) {
+    case 0:
+        gen_printf("int d%u = ", k);
+        gen_expr(depth);
+        gen_printf(";\nsum += d%u;\n", k);
+        break;
+    case 1:
+        gen_printf("Inner d%u = (Inner) { .y = ", k);
+        gen_expr(depth);
+        gen_printf(" };\nsum += d%u.y;\n", k);
+        break;
+    default:
+        gen_printf("Item d%u = { .pos[1] = { %u, ", k, gen_rand(10));
+        gen_expr(depth);
+        gen_printf(" }, .v.f = 1.5 };\nsum += d%u.pos[1].y;\n", k);
+        break;
+    }
+}
+
+static void gen_stmt(int depth)
+{
+    unsigned k, n, len;
+
+    switch (depth > 4 ? gen_rand(2) : gen_rand(6)) {
+    case 0:
+        gen_printf("sum += ");
+        gen_expr(depth);
+        gen_printf(";\n");
+        break;
+    case 1:
+        gen_decl(depth);
+        break;
+    case 2:
+        k = gen_vars++;
+        gen_printf("for (Inner d%u = (Inner) { .x = 0, .y = ", k);
+        gen_expr(depth);
+        gen_printf(" }; d%u.x < %u; d%u.x++) ", k, gen_rand(4), k);
+        gen_block(depth + 1);
+        break;
+    case 3:
+        k = gen_vars++;
+        gen_printf("for (int d%u = use_item((Item) { .pos = { [1] = "
+                   "(Inner) { .x = ", k);
+        gen_expr(depth);
+        gen_printf(" } } }); d%u < %u; d%u++) ", k, gen_rand(4), k);
+        gen_block(depth + 1);
+        break;
+    case 4:
+        len = 1 + gen_rand(depth ? 4 : 32);
+        for (n = 0; n < len; n++) {
+            gen_printf("%sif (sum == %u) ", n ? "else " : "", gen_rand(50));
+            gen_block(depth + 1);
+        }
+        gen_printf("else ");
+        gen_block(depth + 1);
+        break;
+    default:
+        gen_block(depth + 1);
+        break;
+    }
+}
+
+/* Statements first, so that the declarations after them need moving */
+static void gen_block(int depth)
+{
+    unsigned n, len = 1 + gen_rand(4);
+
+    gen_printf("{\n");
+    for (n = 0; n < len && gen_buf.len < gen_max_len; n++)
+        gen_stmt(depth);
+    gen_printf("}\n");
+}
+
+static void gen_array(unsigned k)
+{
+    unsigned n, len = 2 + gen_rand(16), first = gen_rand(len);
+
+    gen_printf("static Item items%u[%u] = {\n", k, len);
+    for (n = 0; n < len; n++) {
+        unsigned idx = (first + n * 7) % len;
+
+        if (gen_rand(3))
+            continue;
+        switch (gen_rand(4)) {
+        case 0:
+            gen_printf("    [%u] = { .v = { .in = { .y = %u } }, .kind = %u },\n",
+                       idx, gen_rand(100), gen_rand(4));
+            break;
+        case 1:
+            gen_printf("    [%u].v.f = %u.5,\n", idx, gen_rand(100));
+            break;
+        case 2:
+            gen_printf("    [%u].pos[1].x = %u,\n", idx, gen_rand(100));
+            break;
+        default:
+            gen_printf("    [%u] = { %u, { %u } },\n", idx, gen_rand(4),
+                       gen_rand(100));
+            break;
+        }
+    }
+    gen_printf("};\n\n");
+}
+
+/* Returns a valid C99 translation unit for the given seed */
+static const char *gen_program(uint64_t seed, size_t *len)
+{
+    unsigned k = 0;
+
+    gen_state = seed * 2654435761u + 1;
+    gen_buf.len = 0;
+    gen_vars = 0;
+    gen_printf("typedef struct Inner { int x, y; } Inner;\n"
+               "typedef union Value { int i; float f; Inner in; } Value;\n"
+               "typedef struct Item { int kind; Value v; Inner pos[2]; } Item;\n\n"
+               "static int use_inner(Inner p) { return p.x + p.y; }\n"
+               "static int use_item(Item it) { return it.kind + it.v.i; }\n\n");
+    while (gen_buf.len < gen_max_len) {
+        if (gen_rand(3)) {
+            gen_printf("int f%u(int v)\n{\nint sum = v;\n", k++);
+            gen_stmt(0);
+            gen_printf("return sum;\n}\n\n");
+        } else {
+            gen_array(k++);
+        }
+    }
+    *len = gen_buf.len;
+
+    return gen_buf.data;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned runs = 100, seed = 1, n;
+    const char *corpus_dir = NULL;
+    int arg = 1, failures = 0;
+
+    while (arg + 1 < argc && argv[arg][0] == '-') {
+        if (!strcmp(argv[arg], "-runs"))
+            runs = (unsigned) atoi(argv[++arg]);
+        else if (!strcmp(argv[arg], "-seed"))
+            seed = (unsigned) atoi(argv[++arg]);
+        else if (!strcmp(argv[arg], "-max-len"))
+            gen_max_len = (unsigned) atoi(argv[++arg]);
+        else if (!strcmp(argv[arg], "-keep"))
+            n_keep = atoi(argv[++arg]);
+        else if (!strcmp(argv[arg], "-save"))
+            setenv("C99_TO_C89_FUZZ_SAVE_DIR", argv[++arg], 1);
+        else if (!strcmp(argv[arg], "-corpus"))
+            corpus_dir = argv[++arg];
+        else
+            break;
+        arg++;
+    }
+    if ((arg < argc && argv[arg][0] == '-') || n_keep < 1 || n_keep > MAX_KEEP) {
+        fprintf(stderr, "%s [-runs N] [-seed N] [-max-len bytes] [-keep N] "
+                "[-save dir] [-corpus dir] [<input> ...]\n", argv[0]);
+        return 1;
+    }
+
+    if (corpus_dir) {
+        mkdir(corpus_dir, 0777);
+        for (n = 0; n < runs; n++) {
+            char name[4096];
+            size_t len;
+            const char *data = gen_program(seed + n, &len);
+
+            snprintf(name, sizeof(name), "%s/seed_%u.c", corpus_dir, seed + n);
+            if (write_whole_file(name, (const uint8_t *) data, len))
+                return 1;
+        }
+        return 0;
+    }
+
+    fuzz_init();
+    if (arg < argc) {
+        for (; arg < argc; arg++) {
+            size_t len;
+            char *data = read_file(argv[arg], &len);
+
+            if (!data) {
+                fprintf(stderr, "Unable to open input file %s\n", argv[arg]);
+                return 1;
+            }
+            failures += run_input((const uint8_t *) data, len);
+            free(data);
+        }
+    } else {
+        for (n = 0; n < runs; n++) {
+            size_t len;
+            const char *data = gen_program(seed + n, &len);
+
+            failures += run_input((const uint8_t *) data, len);
+        }
+    }
+    release_parser();
+    unlink(fuzz_in);
+    unlink(fuzz_out);
+
+    printf("%d inputs failed (%d not valid C89, %d not converted), "
+           "the slowest are in %s/corpus.txt\n", failures, n_oracle_failures,
+           n_conversion_failures, save_dir);
+
+    return failures ? 1 : 0;
+}
+#endif
@@ -0,0 +1,199 @@
+/*
+ * Generator of synthetic C99 translation units for benchmarking c99conv
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Writes a self-contained (already preprocessed) C99 file to stdout that
+ * exercises the constructs c99conv rewrites, with the amount of each set
+ * on the command line, so that stress inputs can be made as big as needed:
+ *
+ *   -structs N    struct types, each with a designated initializer
+ *   -literals N   functions using compound literals
+ *   -array N      entries of a designated array initializer
+ *   -sparsity K   distance between the indices of those entries (default 2)
+ *   -enum N       enumerators, and an array initializer designated by them
+ *   -depth N      nesting depth of a designated struct initializer
+ *   -literals-per-fn N  compound literals in a single function
+ *   -decls N      declarations mixed with statements in a single block
+ *
+ * Each option scales one dimension of the input on its own, which is what
+ * c99scale relies on. The output only depends on the options.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int n_structs = 0, n_literals = 0, n_array = 0, sparsity = 2;
+static int n_enum = 0, depth = 0, literals_per_fn = 0, n_decls = 0;
+
+static void gen_structs(void)
+{
+    int n;
+
+    for (n = 0; n < n_structs; n++) {
+        printf("typedef struct S%d {\n"
+               "    int a, b;\n"
+               "    const char *name;\n"
+               "    struct { int x, y; } pos;\n"
+               "} S%d;\n\n", n, n);
+        printf("static const S%d s%d = {\n"
+               "    .name = \"s%d\",\n"
+               "    .pos = { .y = %d },\n"
+               "    .b = %d,\n"
+               "};\n\n", n, n, n, n, n);
+    }
+}
+
+static void gen_literals(void)
+{
+    int n;
+
+    if (!n_literals)
+        return;
+    printf("typedef struct Rational { int num, den; } Rational;\n\n"
+           "static int use_rational(Rational r) { return r.num * r.den; }\n\n");
+    for (n = 0; n < n_literals; n++) {
+        printf("int literals%d(int v)\n"
+               "{\n"
+               "    Rational r = (Rational) { v, %d };\n"
+               "    int sum = use_rational((Rational) { %d, v });\n"
+               "    r = (Rational) { .den = sum, .num = v };\n"
+               "    int t = ((const int[]) { %d, 1, 2 })[v & 1];\n"
+               "    for (int i = 0; i < v; i++)\n"
+               "        sum += use_rational((Rational) { i, t });\n"
+               "    return sum + r.num;\n"
+               "}\n\n", n, n + 1, n, n);
+    }
+}
+
+/* Entries in reverse order, so that they all have to be sorted */
+static void gen_array(void)
+{
+    int n;
+
+    if (!n_array)
+        return;
+    printf("static const int designated[%d] = {\n", n_array * sparsity);
+    for (n = n_array - 1; n >= 0; n--)
+        printf("    [%d] = %d,\n", n * sparsity + sparsity - 1, n * 3);
+    printf("};\n\n");
+}
+
+static void gen_enum(void)
+{
+    int n;
+
+    if (!n_enum)
+        return;
+    printf("enum Big {\n");
+    for (n = 0; n < n_enum; n++)
+        printf("    BIG_%d,\n", n);
+    printf("    BIG_COUNT\n};\n\n"
+           "static const char *const big_names[BIG_COUNT] = {\n");
+    for (n = n_enum - 1; n >= 0; n -= sparsity)
+        printf("    [BIG_%d] = \"big %d\",\n", n, n);
+    printf("};\n\n");
+}
+
+static void gen_depth(void)
+{
+    int n;
+
+    if (!depth)
+        return;
+    printf("typedef struct Nest0 { int a, b; } Nest0;\n");
+    for (n = 1; n <= depth; n++)
+        printf("typedef struct Nest%d { int a; Nest%d inner; int b; } Nest%d;\n",
+               n, n - 1, n);
+    printf("\nstatic const Nest%d nest = ", depth);
+    for (n = depth; n > 0; n--)
+        printf("{ .b = %d, .inner = ", n);
+    printf("{ .b = 0, .a = 1 }");
+    for (n = 0; n < depth; n++)
+        printf(" }");
+    printf(";\n\n");
+}
+
+static void gen_literals_per_fn(void)
+{
+    int n;
+
+    if (!literals_per_fn)
+        return;
+    printf("typedef struct Point { int x, y; } Point;\n\n"
+           "static int use_point(Point p) { return p.x - p.y; }\n\n"
+           "int many_literals(int v)\n{\n    int sum = 0;\n");
+    for (n = 0; n < literals_per_fn; n++)
+        printf("    sum += use_point((Point) { .y = v, .x = %d });\n", n);
+    printf("    return sum;\n}\n\n");
+}
+
+static void gen_decls(void)
+{
+    int n;
+
+    if (!n_decls)
+        return;
+    printf("int many_decls(int v)\n{\n    int d0 = v;\n");
+    for (n = 1; n < n_decls; n++)
+        printf("    v += d%d;\n    int d%d = v * %d;\n", n - 1, n, n);
+    printf("    return v + d%d;\n}\n\n", n_decls - 1);
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        int v = atoi(argv[i + 1]);
+
+        if (!strcmp(argv[i], "-structs"))
+            n_structs = v;
+        else if (!strcmp(argv[i], "-literals"))
+            n_literals = v;
+        else if (!strcmp(argv[i], "-array"))
+            n_array = v;
+        else if (!strcmp(argv[i], "-sparsity") && v > 0)
+            sparsity = v;
+        else if (!strcmp(argv[i], "-enum"))
+            n_enum = v;
+        else if (!strcmp(argv[i], "-depth"))
+            depth = v;
+        else if (!strcmp(argv[i], "-literals-per-fn"))
+            literals_per_fn = v;
+        else if (!strcmp(argv[i], "-decls"))
+            n_decls = v;
+        else
+            break;
+    }
+    if (i < argc) {
+        fprintf(stderr, "%s [-structs N] [-literals N] [-array N] "
+                "[-sparsity K] [-enum N] [-depth N] [-literals-per-fn N] "
+                "[-decls N]\n", argv[0]);
+        return 1;
+    }
+
+    printf("/* generated by c99gen */\n\n");
+    gen_structs();
+    gen_literals();
+    gen_array();
+    gen_enum();
+    gen_depth();
+    gen_literals_per_fn();
+    gen_decls();
+
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*
+ * Complexity regression test for c99conv
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * For each series (one c99gen dimension), generates inputs of doubling
+ * size, converts each one a few times and keeps the fastest run, minus
+ * the time c99conv takes on an empty file. The growth exponent k of
+ * time ~ n^k is then the least-squares slope of log(time) over log(n).
+ * Over the sizes used here, n log n fits to about 1.15 and n^2 to 2, so
+ * a series fails when k exceeds -limit (default 1.5). A series stops
+ * growing once a conversion takes longer than -budget seconds, and is
+ * fitted over the sizes done so far. The exit code is 1 if any series
+ * fails or does not convert. Linux only, like c99bench.
+ */
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define MAX_STEPS 16
+
+typedef struct {
+    const char *name;
+    const char *options; // c99gen options, the size is appended
+    int start;
+} Series;
+
+static const Series series[] = {
+    { "structs",         "-structs",            250 },
+    { "enum",            "-enum",              1000 },
+    { "array",           "-array",             1000 },
+    { "sparsity",        "-array 200 -sparsity",  8 },
+    { "depth",           "-depth",                8 },
+    { "literals-per-fn", "-literals-per-fn",    125 },
+    { "decls",           "-decls",              125 },
+};
+#define N_SERIES (sizeof(series) / sizeof(series[0]))
+
+static const char *gen = "./bench/c99gen", *conv = "./c99conv";
+static char in_file[64], out_file[64];
+
+static double get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+/* Runs argv with stdout to out (if not NULL), returns its exit status */
+static int run(char **argv, const char *out)
+{
+    int status;
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (!pid) {
+        if (out) {
+            int fd = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0 || dup2(fd, 1) < 0) {
+                perror(out);
+                _exit(127);
+            }
+            close(fd);
+        }
+        execv(argv[0], argv);
+        perror(argv[0]);
+        _exit(127);
+    }
+    if (waitpid(pid, &status, 0) < 0) {
+        perror("waitpid");
+        exit(1);
+    }
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+/* Writes the c99gen output for options and size to in_file */
+static int generate(const char *options, int size)
+{
+    char buf[256], *argv[16], *save, *tok;
+    int argc = 0;
+
+    snprintf(buf, sizeof(buf), "%s %d", options, size);
+    argv[argc++] = (char *) gen;
+    for (tok = strtok_r(buf, " ", &save); tok && argc < 15;
+         tok = strtok_r(NULL, " ", &save))
+        argv[argc++] = tok;
+    argv[argc] = NULL;
+
+    return run(argv, in_file);
+}
+
+/* Fastest of runs conversions of in_file in seconds, or < 0 on failure */
+static double convert_time(int runs)
+{
+    char *argv[] = { (char *) conv, in_file, out_file, NULL };
+    double best = -1.0;
+    int n;
+
+    for (n = 0; n < runs; n++) {
+        double t0 = get_time(), t;
+
+        if (run(argv, NULL))
+            return -1.0;
+        t = get_time() - t0;
+        if (best < 0 || t < best)
+            best = t;
+    }
+
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    double limit = 1.5, budget = 5.0, empty;
+    int runs = 3, steps = 5, i, failures = 0;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-runs"))
+            runs = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-steps"))
+            steps = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-limit"))
+            limit = atof(argv[i + 1]);
+        else if (!strcmp(argv[i], "-budget"))
+            budget = atof(argv[i + 1]);
+        else if (!strcmp(argv[i], "-gen"))
+            gen = argv[i + 1];
+        else if (!strcmp(argv[i], "-conv"))
+            conv = argv[i + 1];
+        else
+            break;
+    }
+    if (i != argc || runs < 1 || steps < 2 || steps > MAX_STEPS) {
+        fprintf(stderr, "%s [-runs N] [-steps N] [-limit exponent] "
+                "[-budget seconds] [-gen c99gen] [-conv c99conv]\n", argv[0]);
+        return 1;
+    }
+    snprintf(in_file, sizeof(in_file), "/tmp/c99scale_%d.c", (int) getpid());
+    snprintf(out_file, sizeof(out_file), "/tmp/c99scale_%d.o.c",
+             (int) getpid());
+
+    if (generate("-structs", 0) || (empty = convert_time(runs)) < 0) {
+        fprintf(stderr, "Unable to convert an empty file with %s\n", conv);
+        return 1;
+    }
+    printf("startup %.2f ms\n", empty * 1000.0);
+
+    for (i = 0; i < (int) N_SERIES; i++) {
+        const Series *s = &series[i];
+        double x[MAX_STEPS], y[MAX_STEPS], sx = 0, sy = 0, sxx = 0, sxy = 0, k;
+        double t = 0.0;
+        int n, done, size = s->start;
+
+        printf("%-16s", s->name);
+        for (n = 0; n < steps && t <= budget; n++, size *= 2) {
+            if (generate(s->options, size) || (t = convert_time(runs)) < 0)
+                break;
+            printf(" %d:%.1fms", size, t * 1000.0);
+            fflush(stdout);
+            // what is left of the startup time is noise
+            t -= empty;
+            if (t < 0.0001)
+                t = 0.0001;
+            x[n] = log(size);
+            y[n] = log(t);
+            sx += x[n];
+            sy += y[n];
+        }
+        if (t < 0 || n < 3) {
+            printf(" %d: FAILED\n", size);
+            failures++;
+            continue;
+        }
+        done = n;
+        for (n = 0; n < done; n++) {
+            sxx += (x[n] - sx / done) * (x[n] - sx / done);
+            sxy += (x[n] - sx / done) * (y[n] - sy / done);
+        }
+        k = sxy / sxx;
+        printf("  k=%.2f%s\n", k, k > limit ? " TOO SLOW" : "");
+        if (k > limit)
+            failures++;
+    }
+    unlink(in_file);
+    unlink(out_file);
+
+    if (failures)
+        printf("%d of %d series failed (limit n^%.2f)\n", failures,
+               (int) N_SERIES, limit);
+
+    return failures ? 1 : 0;
+}
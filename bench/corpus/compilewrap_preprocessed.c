@@ -0,0 +1,9817 @@
+# 0 "compilewrap.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "compilewrap.c"
+# 23 "compilewrap.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h" 3 4
+typedef __ssize_t cookie_read_function_t (void *__cookie, char *__buf,
+                                          size_t __nbytes);
+
+
+
+
+
+
+
+typedef __ssize_t cookie_write_function_t (void *__cookie, const char *__buf,
+                                           size_t __nbytes);
+
+
+
+
+
+
+
+typedef int cookie_seek_function_t (void *__cookie, __off64_t *__pos, int __w);
+
+
+typedef int cookie_close_function_t (void *__cookie);
+
+
+
+
+
+
+typedef struct _IO_cookie_io_functions_t
+{
+  cookie_read_function_t *read;
+  cookie_write_function_t *write;
+  cookie_seek_function_t *seek;
+  cookie_close_function_t *close;
+} cookie_io_functions_t;
+# 47 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+
+
+
+
+
+
+typedef __off64_t off64_t;
+
+
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+
+
+
+
+typedef __fpos64_t fpos64_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ ));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ ));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ ));
+# 170 "/usr/include/stdio.h" 3 4
+extern int renameat2 (int __oldfd, const char *__old, int __newfd,
+        const char *__new, unsigned int __flags) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) ;
+# 200 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile64 (void)
+   __attribute__ ((__malloc__)) ;
+
+
+
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ )) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__)) ;
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 249 "/usr/include/stdio.h" 3 4
+extern int fcloseall (void);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 283 "/usr/include/stdio.h" 3 4
+extern FILE *fopen64 (const char *__restrict __filename,
+        const char *__restrict __modes)
+  __attribute__ ((__malloc__)) ;
+extern FILE *freopen64 (const char *__restrict __filename,
+   const char *__restrict __modes,
+   FILE *__restrict __stream) ;
+
+
+
+
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__malloc__)) ;
+
+
+
+
+
+extern FILE *fopencookie (void *__restrict __magic_cookie,
+     const char *__restrict __modes,
+     cookie_io_functions_t __io_funcs) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__malloc__)) ;
+
+
+
+
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__)) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__malloc__)) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ ));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ ));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+
+
+
+
+
+extern int vasprintf (char **__restrict __ptr, const char *__restrict __f,
+        __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 0))) ;
+extern int __asprintf (char **__restrict __ptr,
+         const char *__restrict __fmt, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 3))) ;
+extern int asprintf (char **__restrict __ptr,
+       const char *__restrict __fmt, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 3))) ;
+
+
+
+
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 214 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+typedef float _Float32;
+# 251 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+typedef double _Float64;
+# 268 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+typedef double _Float32x;
+# 285 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+typedef long double _Float64x;
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ ))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ ))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     ;
+# 615 "/usr/include/stdio.h" 3 4
+extern char *fgets_unlocked (char *__restrict __s, int __n,
+        FILE *__restrict __stream)
+    ;
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 691 "/usr/include/stdio.h" 3 4
+extern int fputs_unlocked (const char *__restrict __s,
+      FILE *__restrict __stream);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 779 "/usr/include/stdio.h" 3 4
+extern int fseeko64 (FILE *__stream, __off64_t __off, int __whence);
+extern __off64_t ftello64 (FILE *__stream) ;
+extern int fgetpos64 (FILE *__restrict __stream, fpos64_t *__restrict __pos);
+extern int fsetpos64 (FILE *__stream, const fpos64_t *__pos);
+
+
+
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ ));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ ));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ ))
+  ;
+
+
+
+
+
+extern char *cuserid (char *__s)
+  ;
+
+
+
+
+struct obstack;
+
+
+extern int obstack_printf (struct obstack *__restrict __obstack,
+      const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 3)));
+extern int obstack_vprintf (struct obstack *__restrict __obstack,
+       const char *__restrict __format,
+       __gnuc_va_list __args)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 0)));
+
+
+
+
+
+
+
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ ));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ )) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ ));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 24 "compilewrap.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ )) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64 strtof64 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 159 "/usr/include/stdlib.h" 3 4
+extern _Float32x strtof32x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64x strtof64x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int strfromd (char *__dest, size_t __size, const char *__format,
+       double __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+
+extern int strfromf (char *__dest, size_t __size, const char *__format,
+       float __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+
+extern int strfroml (char *__dest, size_t __size, const char *__format,
+       long double __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+# 233 "/usr/include/stdlib.h" 3 4
+extern int strfromf32 (char *__dest, size_t __size, const char * __format,
+         _Float32 __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64 (char *__dest, size_t __size, const char * __format,
+         _Float64 __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+# 251 "/usr/include/stdlib.h" 3 4
+extern int strfromf32x (char *__dest, size_t __size, const char * __format,
+   _Float32x __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64x (char *__dest, size_t __size, const char * __format,
+   _Float64x __f)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+# 273 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 274 "/usr/include/stdlib.h" 2 3 4
+
+extern long int strtol_l (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base,
+     locale_t __loc) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 4)));
+
+extern unsigned long int strtoul_l (const char *__restrict __nptr,
+        char **__restrict __endptr,
+        int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern long long int strtoll_l (const char *__restrict __nptr,
+    char **__restrict __endptr, int __base,
+    locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern unsigned long long int strtoull_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 4)));
+
+extern double strtod_l (const char *__restrict __nptr,
+   char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+extern float strtof_l (const char *__restrict __nptr,
+         char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+extern long double strtold_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+# 317 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64 strtof64_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+# 338 "/usr/include/stdlib.h" 3 4
+extern _Float32x strtof32x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64x strtof64x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ )) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+
+
+
+typedef __ino64_t ino64_t;
+
+
+
+
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __useconds_t useconds_t;
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+
+
+  return ((__uint16_t) ((((__bsx) >> 8) & 0xff) | (((__bsx) & 0xff) << 8)));
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+
+
+  return ((((__bsx) & 0xff000000u) >> 24) | (((__bsx) & 0x00ff0000u) >> 8) | (((__bsx) & 0x0000ff00u) << 8) | (((__bsx) & 0x000000ffu) << 24));
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+
+
+  return ((((__bsx) & 0xff00000000000000ull) >> 56) | (((__bsx) & 0x00ff000000000000ull) >> 40) | (((__bsx) & 0x0000ff0000000000ull) >> 24) | (((__bsx) & 0x000000ff00000000ull) >> 8) | (((__bsx) & 0x00000000ff000000ull) << 8) | (((__bsx) & 0x0000000000ff0000ull) << 24) | (((__bsx) & 0x000000000000ff00ull) << 40) | (((__bsx) & 0x00000000000000ffull) << 56));
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+# 49 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+    __fd_mask fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 219 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __blkcnt64_t blkcnt64_t;
+typedef __fsblkcnt64_t fsblkcnt64_t;
+typedef __fsfilcnt64_t fsfilcnt64_t;
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ ));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ ));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ ));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ ));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ ));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ ));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ ));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ )) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__))
+     ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__)) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__warn_unused_result__)) ;
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__warn_unused_result__))
+    
+    ;
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ )) ;
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__))
+     ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ )) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ )) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ )) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ )) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern char *secure_getenv (const char *__name)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int putenv (char *__string) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ ));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 718 "/usr/include/stdlib.h" 3 4
+extern int mkstemp64 (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 740 "/usr/include/stdlib.h" 3 4
+extern int mkstemps64 (char *__template, int __suffixlen)
+     __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+# 762 "/usr/include/stdlib.h" 3 4
+extern int mkostemp (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 772 "/usr/include/stdlib.h" 3 4
+extern int mkostemp64 (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 782 "/usr/include/stdlib.h" 3 4
+extern int mkostemps (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 794 "/usr/include/stdlib.h" 3 4
+extern int mkostemps64 (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+
+
+
+
+
+extern char *canonicalize_file_name (const char *__name)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) __attribute__ ((__malloc__))
+     ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+
+
+typedef __compar_fn_t comparison_fn_t;
+
+
+
+typedef int (*__compar_d_fn_t) (const void *, const void *, void *);
+
+
+
+
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+
+extern void qsort_r (void *__base, size_t __nmemb, size_t __size,
+       __compar_d_fn_t __compar, void *__arg)
+  __attribute__ ((__nonnull__ (1, 4)));
+
+
+
+
+extern int abs (int __x) __attribute__ ((__nothrow__ )) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ )) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ ));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ ));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ ));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ ))
+    ;
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ ))
+ 
+  ;
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+
+
+
+
+
+
+
+extern int posix_openpt (int __oflag) ;
+
+
+
+
+
+
+
+extern int grantpt (int __fd) __attribute__ ((__nothrow__ ));
+
+
+
+extern int unlockpt (int __fd) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern char *ptsname (int __fd) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+
+extern int ptsname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2))) ;
+
+
+extern int getpt (void);
+
+
+
+
+
+
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 25 "compilewrap.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      ;
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 4)))
+     ;
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+   
+    ;
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ ));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ ));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ ));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)))
+    ;
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ ));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ ));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ ));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)))
+    ;
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 26 "compilewrap.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 27 "compilewrap.c" 2
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/stat.h" 1 3 4
+# 99 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stat.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/stat.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+struct stat
+  {
+
+
+
+    __dev_t st_dev;
+
+
+
+
+    __ino_t st_ino;
+
+
+
+
+
+
+
+    __nlink_t st_nlink;
+    __mode_t st_mode;
+
+    __uid_t st_uid;
+    __gid_t st_gid;
+
+    int __pad0;
+
+    __dev_t st_rdev;
+
+
+
+
+    __off_t st_size;
+
+
+
+    __blksize_t st_blksize;
+
+    __blkcnt_t st_blocks;
+# 74 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    struct timespec st_atim;
+    struct timespec st_mtim;
+    struct timespec st_ctim;
+# 89 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    __syscall_slong_t __glibc_reserved[3];
+# 99 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+  };
+
+
+
+struct stat64
+  {
+
+
+
+    __dev_t st_dev;
+
+    __ino64_t st_ino;
+    __nlink_t st_nlink;
+    __mode_t st_mode;
+
+
+
+
+
+
+    __uid_t st_uid;
+    __gid_t st_gid;
+
+    int __pad0;
+    __dev_t st_rdev;
+    __off_t st_size;
+
+
+
+
+
+    __blksize_t st_blksize;
+    __blkcnt64_t st_blocks;
+
+
+
+
+
+
+
+    struct timespec st_atim;
+    struct timespec st_mtim;
+    struct timespec st_ctim;
+# 151 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    __syscall_slong_t __glibc_reserved[3];
+
+
+
+
+  };
+# 26 "/usr/include/x86_64-linux-gnu/bits/stat.h" 2 3 4
+# 102 "/usr/include/x86_64-linux-gnu/sys/stat.h" 2 3 4
+# 205 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int stat (const char *__restrict __file,
+   struct stat *__restrict __buf) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int fstat (int __fd, struct stat *__buf) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+# 240 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int stat64 (const char *__restrict __file,
+     struct stat64 *__restrict __buf) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+extern int fstat64 (int __fd, struct stat64 *__buf) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+# 264 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int fstatat (int __fd, const char *__restrict __file,
+      struct stat *__restrict __buf, int __flag)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+# 291 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int fstatat64 (int __fd, const char *__restrict __file,
+        struct stat64 *__restrict __buf, int __flag)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+# 313 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int lstat (const char *__restrict __file,
+    struct stat *__restrict __buf) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+# 338 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int lstat64 (const char *__restrict __file,
+      struct stat64 *__restrict __buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+# 352 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int chmod (const char *__file, __mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int lchmod (const char *__file, __mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int fchmod (int __fd, __mode_t __mode) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern int fchmodat (int __fd, const char *__file, __mode_t __mode,
+       int __flag)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+
+
+
+extern __mode_t umask (__mode_t __mask) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern __mode_t getumask (void) __attribute__ ((__nothrow__ ));
+
+
+
+extern int mkdir (const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mkdirat (int __fd, const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+extern int mknod (const char *__path, __mode_t __mode, __dev_t __dev)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mknodat (int __fd, const char *__path, __mode_t __mode,
+      __dev_t __dev) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int mkfifo (const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mkfifoat (int __fd, const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+extern int utimensat (int __fd, const char *__path,
+        const struct timespec __times[2],
+        int __flags)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+# 452 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int futimens (int __fd, const struct timespec __times[2]) __attribute__ ((__nothrow__ ));
+# 465 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/statx.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/statx.h" 3 4
+# 1 "/usr/include/linux/stat.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/linux/types.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/types.h" 1 3 4
+# 1 "/usr/include/asm-generic/types.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/include/asm-generic/int-ll64.h" 1 3 4
+# 12 "/usr/include/asm-generic/int-ll64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 3 4
+# 1 "/usr/include/asm-generic/bitsperlong.h" 1 3 4
+# 12 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 2 3 4
+# 13 "/usr/include/asm-generic/int-ll64.h" 2 3 4
+
+
+
+
+
+
+
+typedef __signed__ char __s8;
+typedef unsigned char __u8;
+
+typedef __signed__ short __s16;
+typedef unsigned short __u16;
+
+typedef __signed__ int __s32;
+typedef unsigned int __u32;
+
+
+__extension__ typedef __signed__ long long __s64;
+__extension__ typedef unsigned long long __u64;
+# 8 "/usr/include/asm-generic/types.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/types.h" 2 3 4
+# 6 "/usr/include/linux/types.h" 2 3 4
+
+
+
+# 1 "/usr/include/linux/posix_types.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/linux/stddef.h" 1 3 4
+# 6 "/usr/include/linux/posix_types.h" 2 3 4
+# 25 "/usr/include/linux/posix_types.h" 3 4
+typedef struct {
+ unsigned long fds_bits[1024 / (8 * sizeof(long))];
+} __kernel_fd_set;
+
+
+typedef void (*__kernel_sighandler_t)(int);
+
+
+typedef int __kernel_key_t;
+typedef int __kernel_mqd_t;
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/posix_types.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 3 4
+typedef unsigned short __kernel_old_uid_t;
+typedef unsigned short __kernel_old_gid_t;
+
+
+typedef unsigned long __kernel_old_dev_t;
+
+
+# 1 "/usr/include/asm-generic/posix_types.h" 1 3 4
+# 15 "/usr/include/asm-generic/posix_types.h" 3 4
+typedef long __kernel_long_t;
+typedef unsigned long __kernel_ulong_t;
+
+
+
+typedef __kernel_ulong_t __kernel_ino_t;
+
+
+
+typedef unsigned int __kernel_mode_t;
+
+
+
+typedef int __kernel_pid_t;
+
+
+
+typedef int __kernel_ipc_pid_t;
+
+
+
+typedef unsigned int __kernel_uid_t;
+typedef unsigned int __kernel_gid_t;
+
+
+
+typedef __kernel_long_t __kernel_suseconds_t;
+
+
+
+typedef int __kernel_daddr_t;
+
+
+
+typedef unsigned int __kernel_uid32_t;
+typedef unsigned int __kernel_gid32_t;
+# 72 "/usr/include/asm-generic/posix_types.h" 3 4
+typedef __kernel_ulong_t __kernel_size_t;
+typedef __kernel_long_t __kernel_ssize_t;
+typedef __kernel_long_t __kernel_ptrdiff_t;
+
+
+
+
+typedef struct {
+ int val[2];
+} __kernel_fsid_t;
+
+
+
+
+
+typedef __kernel_long_t __kernel_off_t;
+typedef long long __kernel_loff_t;
+typedef __kernel_long_t __kernel_old_time_t;
+typedef __kernel_long_t __kernel_time_t;
+typedef long long __kernel_time64_t;
+typedef __kernel_long_t __kernel_clock_t;
+typedef int __kernel_timer_t;
+typedef int __kernel_clockid_t;
+typedef char * __kernel_caddr_t;
+typedef unsigned short __kernel_uid16_t;
+typedef unsigned short __kernel_gid16_t;
+# 19 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 2 3 4
+# 8 "/usr/include/x86_64-linux-gnu/asm/posix_types.h" 2 3 4
+# 37 "/usr/include/linux/posix_types.h" 2 3 4
+# 10 "/usr/include/linux/types.h" 2 3 4
+# 27 "/usr/include/linux/types.h" 3 4
+typedef __u16 __le16;
+typedef __u16 __be16;
+typedef __u32 __le32;
+typedef __u32 __be32;
+typedef __u64 __le64;
+typedef __u64 __be64;
+
+typedef __u16 __sum16;
+typedef __u32 __wsum;
+# 51 "/usr/include/linux/types.h" 3 4
+typedef unsigned __poll_t;
+# 6 "/usr/include/linux/stat.h" 2 3 4
+# 56 "/usr/include/linux/stat.h" 3 4
+struct statx_timestamp {
+ __s64 tv_sec;
+ __u32 tv_nsec;
+ __s32 __reserved;
+};
+# 99 "/usr/include/linux/stat.h" 3 4
+struct statx {
+
+ __u32 stx_mask;
+ __u32 stx_blksize;
+ __u64 stx_attributes;
+
+ __u32 stx_nlink;
+ __u32 stx_uid;
+ __u32 stx_gid;
+ __u16 stx_mode;
+ __u16 __spare0[1];
+
+ __u64 stx_ino;
+ __u64 stx_size;
+ __u64 stx_blocks;
+ __u64 stx_attributes_mask;
+
+ struct statx_timestamp stx_atime;
+ struct statx_timestamp stx_btime;
+ struct statx_timestamp stx_ctime;
+ struct statx_timestamp stx_mtime;
+
+ __u32 stx_rdev_major;
+ __u32 stx_rdev_minor;
+ __u32 stx_dev_major;
+ __u32 stx_dev_minor;
+
+ __u64 stx_mnt_id;
+ __u32 stx_dio_mem_align;
+ __u32 stx_dio_offset_align;
+
+ __u64 __spare3[12];
+
+};
+# 32 "/usr/include/x86_64-linux-gnu/bits/statx.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx_timestamp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 2 3 4
+# 57 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 3 4
+
+
+
+int statx (int __dirfd, const char *__restrict __path, int __flags,
+           unsigned int __mask, struct statx *__restrict __buf)
+  __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 5)));
+
+
+# 40 "/usr/include/x86_64-linux-gnu/bits/statx.h" 2 3 4
+# 466 "/usr/include/x86_64-linux-gnu/sys/stat.h" 2 3 4
+
+
+
+# 29 "compilewrap.c" 2
+
+
+
+
+
+
+
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+# 274 "/usr/include/unistd.h" 3 4
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int euidaccess (const char *__name, int __type)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int eaccess (const char *__name, int __type)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int execveat (int __fd, const char *__path, char *const __argv[],
+                     char *const __envp[], int __flags)
+    __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+
+
+
+
+
+
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2))) ;
+# 339 "/usr/include/unistd.h" 3 4
+extern __off_t lseek (int __fd, __off_t __offset, int __whence) __attribute__ ((__nothrow__ ));
+# 350 "/usr/include/unistd.h" 3 4
+extern __off64_t lseek64 (int __fd, __off64_t __offset, int __whence)
+     __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    ;
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    ;
+# 389 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes,
+        __off_t __offset)
+    ;
+
+
+
+
+
+
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __n,
+         __off_t __offset)
+    ;
+# 422 "/usr/include/unistd.h" 3 4
+extern ssize_t pread64 (int __fd, void *__buf, size_t __nbytes,
+   __off64_t __offset)
+    ;
+
+
+extern ssize_t pwrite64 (int __fd, const void *__buf, size_t __n,
+    __off64_t __offset)
+    ;
+
+
+
+
+
+
+
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int pipe2 (int __pipedes[2], int __flags) __attribute__ ((__nothrow__ )) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ ));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ )) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+extern char *get_current_dir_name (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    ;
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ )) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern int dup3 (int __fd, int __fd2, int __flags) __attribute__ ((__nothrow__ ));
+
+
+
+extern char **__environ;
+
+extern char **environ;
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execvpe (const char *__file, char *const __argv[],
+      char *const __envp[])
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int nice (int __inc) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ ));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ ));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ ))
+    ;
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ ));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ ));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ ));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ ));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ ));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ ));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ ));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ ));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ ));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ ));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ ))
+    ;
+
+
+extern int group_member (__gid_t __gid) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+extern int getresuid (__uid_t *__ruid, __uid_t *__euid, __uid_t *__suid)
+     __attribute__ ((__nothrow__ ));
+
+
+
+extern int getresgid (__gid_t *__rgid, __gid_t *__egid, __gid_t *__sgid)
+     __attribute__ ((__nothrow__ ));
+
+
+
+extern int setresuid (__uid_t __ruid, __uid_t __euid, __uid_t __suid)
+     __attribute__ ((__nothrow__ )) ;
+
+
+
+extern int setresgid (__gid_t __rgid, __gid_t __egid, __gid_t __sgid)
+     __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern __pid_t _Fork (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ ));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)))
+     ;
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)))
+     ;
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)))
+     ;
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ ));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    ;
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)))
+    ;
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)))
+     ;
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ ));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ ));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ ));
+extern void endusershell (void) __attribute__ ((__nothrow__ ));
+extern void setusershell (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+
+
+
+
+
+extern int syncfs (int __fd) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ ));
+# 1026 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off_t __length)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+# 1038 "/usr/include/unistd.h" 3 4
+extern int truncate64 (const char *__file, __off64_t __length)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) ;
+# 1049 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off_t __length) __attribute__ ((__nothrow__ )) ;
+# 1059 "/usr/include/unistd.h" 3 4
+extern int ftruncate64 (int __fd, __off64_t __length) __attribute__ ((__nothrow__ )) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ )) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ ));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ ));
+# 1114 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off_t __len) ;
+# 1124 "/usr/include/unistd.h" 3 4
+extern int lockf64 (int __fd, int __cmd, __off64_t __len) ;
+# 1142 "/usr/include/unistd.h" 3 4
+ssize_t copy_file_range (int __infd, __off64_t *__pinoff,
+    int __outfd, __off64_t *__poutoff,
+    size_t __length, unsigned int __flags);
+
+
+
+
+
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void swab (const void *__restrict __from, void *__restrict __to,
+    ssize_t __n) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)))
+   
+    ;
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    ;
+# 1208 "/usr/include/unistd.h" 3 4
+extern int close_range (unsigned int __fd, unsigned int __max_fd,
+   int __flags) __attribute__ ((__nothrow__ ));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 3 4
+extern __pid_t gettid (void) __attribute__ ((__nothrow__ ));
+
+
+
+# 1 "/usr/include/linux/close_range.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 2 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 37 "compilewrap.c" 2
+# 1 "/usr/include/errno.h" 1 3 4
+# 28 "/usr/include/errno.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/errno.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/errno.h" 3 4
+# 1 "/usr/include/linux/errno.h" 1 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/errno.h" 1 3 4
+# 1 "/usr/include/asm-generic/errno.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/asm-generic/errno-base.h" 1 3 4
+# 6 "/usr/include/asm-generic/errno.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/errno.h" 2 3 4
+# 2 "/usr/include/linux/errno.h" 2 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/errno.h" 2 3 4
+# 29 "/usr/include/errno.h" 2 3 4
+
+
+
+
+
+
+
+
+extern int *__errno_location (void) __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern char *program_invocation_name;
+extern char *program_invocation_short_name;
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h" 3 4
+typedef int error_t;
+# 49 "/usr/include/errno.h" 2 3 4
+
+
+
+
+# 38 "compilewrap.c" 2
+# 1 "/usr/include/fcntl.h" 1 3 4
+# 28 "/usr/include/fcntl.h" 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 3 4
+struct flock
+  {
+    short int l_type;
+    short int l_whence;
+
+    __off_t l_start;
+    __off_t l_len;
+
+
+
+
+    __pid_t l_pid;
+  };
+
+
+struct flock64
+  {
+    short int l_type;
+    short int l_whence;
+    __off64_t l_start;
+    __off64_t l_len;
+    __pid_t l_pid;
+  };
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 2 3 4
+
+
+struct iovec
+  {
+    void *iov_base;
+    size_t iov_len;
+  };
+# 39 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 2 3 4
+# 265 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+enum __pid_type
+  {
+    F_OWNER_TID = 0,
+    F_OWNER_PID,
+    F_OWNER_PGRP,
+    F_OWNER_GID = F_OWNER_PGRP
+  };
+
+
+struct f_owner_ex
+  {
+    enum __pid_type type;
+    __pid_t pid;
+  };
+# 354 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+# 1 "/usr/include/linux/falloc.h" 1 3 4
+# 355 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 2 3 4
+
+
+
+struct file_handle
+{
+  unsigned int handle_bytes;
+  int handle_type;
+
+  unsigned char f_handle[0];
+};
+# 393 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+
+
+
+
+
+extern __ssize_t readahead (int __fd, __off64_t __offset, size_t __count)
+    __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int sync_file_range (int __fd, __off64_t __offset, __off64_t __count,
+       unsigned int __flags);
+
+
+
+
+
+
+extern __ssize_t vmsplice (int __fdout, const struct iovec *__iov,
+      size_t __count, unsigned int __flags);
+
+
+
+
+
+extern __ssize_t splice (int __fdin, __off64_t *__offin, int __fdout,
+    __off64_t *__offout, size_t __len,
+    unsigned int __flags);
+
+
+
+
+
+extern __ssize_t tee (int __fdin, int __fdout, size_t __len,
+        unsigned int __flags);
+
+
+
+
+
+
+extern int fallocate (int __fd, int __mode, __off_t __offset, __off_t __len);
+# 448 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+extern int fallocate64 (int __fd, int __mode, __off64_t __offset,
+   __off64_t __len);
+
+
+
+
+extern int name_to_handle_at (int __dfd, const char *__name,
+         struct file_handle *__handle, int *__mnt_id,
+         int __flags) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+extern int open_by_handle_at (int __mountdirfd, struct file_handle *__handle,
+         int __flags);
+
+
+
+
+# 62 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 2 3 4
+# 36 "/usr/include/fcntl.h" 2 3 4
+# 78 "/usr/include/fcntl.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stat.h" 1 3 4
+# 79 "/usr/include/fcntl.h" 2 3 4
+# 149 "/usr/include/fcntl.h" 3 4
+extern int fcntl (int __fd, int __cmd, ...);
+# 158 "/usr/include/fcntl.h" 3 4
+extern int fcntl64 (int __fd, int __cmd, ...);
+# 181 "/usr/include/fcntl.h" 3 4
+extern int open (const char *__file, int __oflag, ...) __attribute__ ((__nonnull__ (1)));
+# 191 "/usr/include/fcntl.h" 3 4
+extern int open64 (const char *__file, int __oflag, ...) __attribute__ ((__nonnull__ (1)));
+# 205 "/usr/include/fcntl.h" 3 4
+extern int openat (int __fd, const char *__file, int __oflag, ...)
+     __attribute__ ((__nonnull__ (2)));
+# 216 "/usr/include/fcntl.h" 3 4
+extern int openat64 (int __fd, const char *__file, int __oflag, ...)
+     __attribute__ ((__nonnull__ (2)));
+# 227 "/usr/include/fcntl.h" 3 4
+extern int creat (const char *__file, mode_t __mode) __attribute__ ((__nonnull__ (1)));
+# 237 "/usr/include/fcntl.h" 3 4
+extern int creat64 (const char *__file, mode_t __mode) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/fcntl.h" 3 4
+extern int posix_fadvise (int __fd, off_t __offset, off_t __len,
+     int __advise) __attribute__ ((__nothrow__ ));
+# 285 "/usr/include/fcntl.h" 3 4
+extern int posix_fadvise64 (int __fd, off64_t __offset, off64_t __len,
+       int __advise) __attribute__ ((__nothrow__ ));
+# 295 "/usr/include/fcntl.h" 3 4
+extern int posix_fallocate (int __fd, off_t __offset, off_t __len);
+# 306 "/usr/include/fcntl.h" 3 4
+extern int posix_fallocate64 (int __fd, off64_t __offset, off64_t __len);
+# 317 "/usr/include/fcntl.h" 3 4
+
+# 39 "compilewrap.c" 2
+# 1 "/usr/include/poll.h" 1 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/poll.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/poll.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/poll.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/sys/poll.h" 2 3 4
+
+
+
+
+
+
+
+typedef unsigned long int nfds_t;
+
+
+struct pollfd
+  {
+    int fd;
+    short int events;
+    short int revents;
+  };
+
+
+
+# 54 "/usr/include/x86_64-linux-gnu/sys/poll.h" 3 4
+extern int poll (struct pollfd *__fds, nfds_t __nfds, int __timeout)
+    ;
+# 64 "/usr/include/x86_64-linux-gnu/sys/poll.h" 3 4
+extern int ppoll (struct pollfd *__fds, nfds_t __nfds,
+    const struct timespec *__timeout,
+    const __sigset_t *__ss)
+    ;
+# 82 "/usr/include/x86_64-linux-gnu/sys/poll.h" 3 4
+
+# 2 "/usr/include/poll.h" 2 3 4
+# 40 "compilewrap.c" 2
+# 1 "/usr/include/spawn.h" 1 3 4
+# 23 "/usr/include/spawn.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+
+
+
+extern int clone (int (*__fn) (void *__arg), void *__child_stack,
+    int __flags, void *__arg, ...) __attribute__ ((__nothrow__ ));
+
+
+extern int unshare (int __flags) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_getcpu (void) __attribute__ ((__nothrow__ ));
+
+
+extern int getcpu (unsigned int *, unsigned int *) __attribute__ ((__nothrow__ ));
+
+
+extern int setns (int __fd, int __nstype) __attribute__ ((__nothrow__ ));
+
+
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ ));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ )) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ ));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ ));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ ));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ ));
+# 130 "/usr/include/sched.h" 3 4
+extern int sched_setaffinity (__pid_t __pid, size_t __cpusetsize,
+         const cpu_set_t *__cpuset) __attribute__ ((__nothrow__ ));
+
+
+extern int sched_getaffinity (__pid_t __pid, size_t __cpusetsize,
+         cpu_set_t *__cpuset) __attribute__ ((__nothrow__ ));
+
+
+
+# 24 "/usr/include/spawn.h" 2 3 4
+
+
+
+
+
+typedef struct
+{
+  short int __flags;
+  pid_t __pgrp;
+  sigset_t __sd;
+  sigset_t __ss;
+  struct sched_param __sp;
+  int __policy;
+  int __pad[16];
+} posix_spawnattr_t;
+
+
+
+
+typedef struct
+{
+  int __allocated;
+  int __used;
+  struct __spawn_action *__actions;
+  int __pad[16];
+} posix_spawn_file_actions_t;
+# 65 "/usr/include/spawn.h" 3 4
+
+
+
+
+
+
+
+extern int posix_spawn (pid_t *__restrict __pid,
+   const char *__restrict __path,
+   const posix_spawn_file_actions_t *__restrict
+   __file_actions,
+   const posix_spawnattr_t *__restrict __attrp,
+   char *const __argv[__restrict],
+   char *const __envp[__restrict])
+    __attribute__ ((__nonnull__ (2, 5)));
+
+
+
+
+
+extern int posix_spawnp (pid_t *__pid, const char *__file,
+    const posix_spawn_file_actions_t *__file_actions,
+    const posix_spawnattr_t *__attrp,
+    char *const __argv[], char *const __envp[])
+    __attribute__ ((__nonnull__ (2, 5)));
+
+
+
+extern int posix_spawnattr_init (posix_spawnattr_t *__attr)
+    __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int posix_spawnattr_destroy (posix_spawnattr_t *__attr)
+    __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int posix_spawnattr_getsigdefault (const posix_spawnattr_t *
+       __restrict __attr,
+       sigset_t *__restrict __sigdefault)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_setsigdefault (posix_spawnattr_t *__restrict __attr,
+       const sigset_t *__restrict
+       __sigdefault)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_getsigmask (const posix_spawnattr_t *__restrict
+           __attr,
+           sigset_t *__restrict __sigmask)
+    __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_setsigmask (posix_spawnattr_t *__restrict __attr,
+           const sigset_t *__restrict __sigmask)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_getflags (const posix_spawnattr_t *__restrict
+         __attr,
+         short int *__restrict __flags)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_setflags (posix_spawnattr_t *_attr,
+         short int __flags)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int posix_spawnattr_getpgroup (const posix_spawnattr_t *__restrict
+          __attr, pid_t *__restrict __pgroup)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_setpgroup (posix_spawnattr_t *__attr,
+          pid_t __pgroup)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int posix_spawnattr_getschedpolicy (const posix_spawnattr_t *
+        __restrict __attr,
+        int *__restrict __schedpolicy)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_setschedpolicy (posix_spawnattr_t *__attr,
+        int __schedpolicy)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int posix_spawnattr_getschedparam (const posix_spawnattr_t *
+       __restrict __attr,
+       struct sched_param *__restrict
+       __schedparam)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawnattr_setschedparam (posix_spawnattr_t *__restrict __attr,
+       const struct sched_param *
+       __restrict __schedparam)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int posix_spawn_file_actions_init (posix_spawn_file_actions_t *
+       __file_actions)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int posix_spawn_file_actions_destroy (posix_spawn_file_actions_t *
+          __file_actions)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int posix_spawn_file_actions_addopen (posix_spawn_file_actions_t *
+          __restrict __file_actions,
+          int __fd,
+          const char *__restrict __path,
+          int __oflag, mode_t __mode)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern int posix_spawn_file_actions_addclose (posix_spawn_file_actions_t *
+           __file_actions, int __fd)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int posix_spawn_file_actions_adddup2 (posix_spawn_file_actions_t *
+          __file_actions,
+          int __fd, int __newfd)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int posix_spawn_file_actions_addchdir_np (posix_spawn_file_actions_t *
+       __restrict __actions,
+       const char *__restrict __path)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int posix_spawn_file_actions_addfchdir_np (posix_spawn_file_actions_t *,
+        int __fd)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int
+posix_spawn_file_actions_addclosefrom_np (posix_spawn_file_actions_t *,
+       int __from)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int
+posix_spawn_file_actions_addtcsetpgrp_np (posix_spawn_file_actions_t *,
+       int __tcfd)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+# 41 "compilewrap.c" 2
+# 1 "/usr/include/pthread.h" 1 3 4
+# 23 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 73 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timex.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+struct timex
+{
+# 58 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+  unsigned int modes;
+  __syscall_slong_t offset;
+  __syscall_slong_t freq;
+  __syscall_slong_t maxerror;
+  __syscall_slong_t esterror;
+  int status;
+  __syscall_slong_t constant;
+  __syscall_slong_t precision;
+  __syscall_slong_t tolerance;
+  struct timeval time;
+  __syscall_slong_t tick;
+  __syscall_slong_t ppsfreq;
+  __syscall_slong_t jitter;
+  int shift;
+  __syscall_slong_t stabil;
+  __syscall_slong_t jitcnt;
+  __syscall_slong_t calcnt;
+  __syscall_slong_t errcnt;
+  __syscall_slong_t stbcnt;
+
+  int tai;
+
+
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32;
+
+};
+# 74 "/usr/include/x86_64-linux-gnu/bits/time.h" 2 3 4
+
+
+
+
+extern int clock_adjtime (__clockid_t __clock_id, struct timex *__utx) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+# 90 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ ));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ ));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ ));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern char *strptime (const char *__restrict __s,
+         const char *__restrict __fmt, struct tm *__tp)
+     __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ ));
+
+
+
+extern char *strptime_l (const char *__restrict __s,
+    const char *__restrict __fmt, struct tm *__tp,
+    locale_t __loc) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ ));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ ));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ ));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ ));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ ));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ ));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ ));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ ));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ ));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ ));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ ));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ ));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ ));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ ));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ ));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 399 "/usr/include/time.h" 3 4
+extern int timespec_getres (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ ));
+# 425 "/usr/include/time.h" 3 4
+extern int getdate_err;
+# 434 "/usr/include/time.h" 3 4
+extern struct tm *getdate (const char *__string);
+# 448 "/usr/include/time.h" 3 4
+extern int getdate_r (const char *__restrict __string,
+        struct tm *__restrict __resbufp);
+
+
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+
+extern long int __sysconf (int __name) __attribute__ ((__nothrow__ ));
+
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+  , PTHREAD_MUTEX_FAST_NP = PTHREAD_MUTEX_TIMED_NP
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+
+
+
+
+extern int pthread_tryjoin_np (pthread_t __th, void **__thread_return) __attribute__ ((__nothrow__ ));
+# 233 "/usr/include/pthread.h" 3 4
+extern int pthread_timedjoin_np (pthread_t __th, void **__thread_return,
+     const struct timespec *__abstime);
+# 243 "/usr/include/pthread.h" 3 4
+extern int pthread_clockjoin_np (pthread_t __th, void **__thread_return,
+                                 clockid_t __clockid,
+     const struct timespec *__abstime);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ ));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ )) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_attr_setaffinity_np (pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern int pthread_attr_getaffinity_np (const pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+
+extern int pthread_getattr_default_np (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_setsigmask_np (pthread_attr_t *__attr,
+           const __sigset_t *sigmask);
+
+
+
+
+extern int pthread_attr_getsigmask_np (const pthread_attr_t *__attr,
+           __sigset_t *sigmask);
+
+
+
+
+
+
+
+extern int pthread_setattr_default_np (const pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_getattr_np (pthread_t __th, pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ ));
+
+
+
+
+extern int pthread_getname_np (pthread_t __target_thread, char *__buf,
+          size_t __buflen)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+extern int pthread_setname_np (pthread_t __target_thread, const char *__name)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int pthread_getconcurrency (void) __attribute__ ((__nothrow__ ));
+
+
+extern int pthread_setconcurrency (int __level) __attribute__ ((__nothrow__ ));
+
+
+
+extern int pthread_yield (void) __attribute__ ((__nothrow__ ));
+
+extern int pthread_yield (void) __asm__ ("" "sched_yield") __attribute__ ((__nothrow__ ))
+  __attribute__ ((__deprecated__))
+                                                      ;
+
+
+
+
+
+
+
+extern int pthread_setaffinity_np (pthread_t __th, size_t __cpusetsize,
+       const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getaffinity_np (pthread_t __th, size_t __cpusetsize,
+       cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (3)));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 732 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel_defer (__pthread_unwind_buf_t *__buf)
+     ;
+# 745 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel_restore (__pthread_unwind_buf_t *__buf)
+  ;
+
+
+
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 773 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp (struct __jmp_buf_tag __env[1],
+   int __savemask) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 817 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_clocklock (pthread_mutex_t *__restrict __mutex,
+        clockid_t __clockid,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_consistent_np (pthread_mutex_t *) __asm__ ("" "pthread_mutex_consistent") __attribute__ ((__nothrow__ ))
+                                __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__))
+                                                                         ;
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_getrobust_np (pthread_mutexattr_t *, int *) __asm__ ("" "pthread_mutexattr_getrobust") __attribute__ ((__nothrow__ ))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__))
+                                                                               ;
+
+
+
+
+
+
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_setrobust_np (pthread_mutexattr_t *, int) __asm__ ("" "pthread_mutexattr_setrobust") __attribute__ ((__nothrow__ ))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__))
+                                                                               ;
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1004 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockrdlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1051 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockwrlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1171 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_clockwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       __clockid_t __clock_id,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 4)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ ));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ ));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ )) ;
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ ));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 42 "compilewrap.c" 2
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/wait.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+
+# 36 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+# 1 "/usr/include/signal.h" 1 3 4
+# 27 "/usr/include/signal.h" 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h" 1 3 4
+# 76 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/signum-arch.h" 1 3 4
+# 77 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h" 2 3 4
+# 31 "/usr/include/signal.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h" 1 3 4
+
+
+
+
+
+
+
+typedef __sig_atomic_t sig_atomic_t;
+# 33 "/usr/include/signal.h" 2 3 4
+# 57 "/usr/include/signal.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigval_t.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/__sigval_t.h" 3 4
+union sigval
+{
+  int sival_int;
+  void *sival_ptr;
+};
+
+typedef union sigval __sigval_t;
+# 7 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 2 3 4
+# 16 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/siginfo-arch.h" 1 3 4
+# 17 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 2 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 3 4
+typedef struct
+  {
+    int si_signo;
+
+    int si_errno;
+
+    int si_code;
+
+
+
+
+
+    int __pad0;
+
+
+    union
+      {
+ int _pad[((128 / sizeof (int)) - 4)];
+
+
+ struct
+   {
+     __pid_t si_pid;
+     __uid_t si_uid;
+   } _kill;
+
+
+ struct
+   {
+     int si_tid;
+     int si_overrun;
+     __sigval_t si_sigval;
+   } _timer;
+
+
+ struct
+   {
+     __pid_t si_pid;
+     __uid_t si_uid;
+     __sigval_t si_sigval;
+   } _rt;
+
+
+ struct
+   {
+     __pid_t si_pid;
+     __uid_t si_uid;
+     int si_status;
+     __clock_t si_utime;
+     __clock_t si_stime;
+   } _sigchld;
+
+
+ struct
+   {
+     void *si_addr;
+    
+     short int si_addr_lsb;
+     union
+       {
+
+  struct
+    {
+      void *_lower;
+      void *_upper;
+    } _addr_bnd;
+
+  __uint32_t _pkey;
+       } _bounds;
+   } _sigfault;
+
+
+ struct
+   {
+     long int si_band;
+     int si_fd;
+   } _sigpoll;
+
+
+
+ struct
+   {
+     void *_call_addr;
+     int _syscall;
+     unsigned int _arch;
+   } _sigsys;
+
+      } _sifields;
+  } siginfo_t ;
+# 58 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 3 4
+enum
+{
+  SI_ASYNCNL = -60,
+  SI_DETHREAD = -7,
+
+  SI_TKILL,
+  SI_SIGIO,
+
+  SI_ASYNCIO,
+  SI_MESGQ,
+  SI_TIMER,
+
+
+
+
+
+  SI_QUEUE,
+  SI_USER,
+  SI_KERNEL = 0x80
+# 66 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 3 4
+};
+
+
+
+
+enum
+{
+  ILL_ILLOPC = 1,
+
+  ILL_ILLOPN,
+
+  ILL_ILLADR,
+
+  ILL_ILLTRP,
+
+  ILL_PRVOPC,
+
+  ILL_PRVREG,
+
+  ILL_COPROC,
+
+  ILL_BADSTK,
+
+  ILL_BADIADDR
+
+};
+
+
+enum
+{
+  FPE_INTDIV = 1,
+
+  FPE_INTOVF,
+
+  FPE_FLTDIV,
+
+  FPE_FLTOVF,
+
+  FPE_FLTUND,
+
+  FPE_FLTRES,
+
+  FPE_FLTINV,
+
+  FPE_FLTSUB,
+
+  FPE_FLTUNK = 14,
+
+  FPE_CONDTRAP
+
+};
+
+
+enum
+{
+  SEGV_MAPERR = 1,
+
+  SEGV_ACCERR,
+
+  SEGV_BNDERR,
+
+  SEGV_PKUERR,
+
+  SEGV_ACCADI,
+
+  SEGV_ADIDERR,
+
+  SEGV_ADIPERR,
+
+  SEGV_MTEAERR,
+
+  SEGV_MTESERR
+
+};
+
+
+enum
+{
+  BUS_ADRALN = 1,
+
+  BUS_ADRERR,
+
+  BUS_OBJERR,
+
+  BUS_MCEERR_AR,
+
+  BUS_MCEERR_AO
+
+};
+
+
+
+
+enum
+{
+  TRAP_BRKPT = 1,
+
+  TRAP_TRACE,
+
+  TRAP_BRANCH,
+
+  TRAP_HWBKPT,
+
+  TRAP_UNK
+
+};
+
+
+
+
+enum
+{
+  CLD_EXITED = 1,
+
+  CLD_KILLED,
+
+  CLD_DUMPED,
+
+  CLD_TRAPPED,
+
+  CLD_STOPPED,
+
+  CLD_CONTINUED
+
+};
+
+
+enum
+{
+  POLL_IN = 1,
+
+  POLL_OUT,
+
+  POLL_MSG,
+
+  POLL_ERR,
+
+  POLL_PRI,
+
+  POLL_HUP
+
+};
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts-arch.h" 1 3 4
+# 214 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 2 3 4
+# 59 "/usr/include/signal.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigval_t.h" 1 3 4
+# 16 "/usr/include/x86_64-linux-gnu/bits/types/sigval_t.h" 3 4
+typedef __sigval_t sigval_t;
+# 63 "/usr/include/signal.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h" 2 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h" 3 4
+typedef struct sigevent
+  {
+    __sigval_t sigev_value;
+    int sigev_signo;
+    int sigev_notify;
+
+    union
+      {
+ int _pad[((64 / sizeof (int)) - 4)];
+
+
+
+ __pid_t _tid;
+
+ struct
+   {
+     void (*_function) (__sigval_t);
+     pthread_attr_t *_attribute;
+   } _sigev_thread;
+      } _sigev_un;
+  } sigevent_t;
+# 67 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigevent-consts.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/sigevent-consts.h" 3 4
+enum
+{
+  SIGEV_SIGNAL = 0,
+
+  SIGEV_NONE,
+
+  SIGEV_THREAD,
+
+
+  SIGEV_THREAD_ID = 4
+
+
+};
+# 68 "/usr/include/signal.h" 2 3 4
+
+
+
+
+typedef void (*__sighandler_t) (int);
+
+
+
+
+extern __sighandler_t __sysv_signal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ ));
+
+extern __sighandler_t sysv_signal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern __sighandler_t signal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ ));
+# 112 "/usr/include/signal.h" 3 4
+extern int kill (__pid_t __pid, int __sig) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int killpg (__pid_t __pgrp, int __sig) __attribute__ ((__nothrow__ ));
+
+
+
+extern int raise (int __sig) __attribute__ ((__nothrow__ ));
+
+
+
+extern __sighandler_t ssignal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ ));
+extern int gsignal (int __sig) __attribute__ ((__nothrow__ ));
+
+
+
+
+extern void psignal (int __sig, const char *__s);
+
+
+extern void psiginfo (const siginfo_t *__pinfo, const char *__s);
+# 151 "/usr/include/signal.h" 3 4
+extern int sigpause (int __sig) __asm__ ("__xpg_sigpause")
+  __attribute__ ((__deprecated__));
+# 173 "/usr/include/signal.h" 3 4
+extern int sigblock (int __mask) __attribute__ ((__nothrow__ )) __attribute__ ((__deprecated__));
+
+
+extern int sigsetmask (int __mask) __attribute__ ((__nothrow__ )) __attribute__ ((__deprecated__));
+
+
+extern int siggetmask (void) __attribute__ ((__nothrow__ )) __attribute__ ((__deprecated__));
+# 188 "/usr/include/signal.h" 3 4
+typedef __sighandler_t sighandler_t;
+
+
+
+
+typedef __sighandler_t sig_t;
+
+
+
+
+
+extern int sigemptyset (sigset_t *__set) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigfillset (sigset_t *__set) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigaddset (sigset_t *__set, int __signo) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigdelset (sigset_t *__set, int __signo) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigismember (const sigset_t *__set, int __signo)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int sigisemptyset (const sigset_t *__set) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigandset (sigset_t *__set, const sigset_t *__left,
+        const sigset_t *__right) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern int sigorset (sigset_t *__set, const sigset_t *__left,
+       const sigset_t *__right) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigaction.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/sigaction.h" 3 4
+struct sigaction
+  {
+
+
+    union
+      {
+
+ __sighandler_t sa_handler;
+
+ void (*sa_sigaction) (int, siginfo_t *, void *);
+      }
+    __sigaction_handler;
+
+
+
+
+
+
+
+    __sigset_t sa_mask;
+
+
+    int sa_flags;
+
+
+    void (*sa_restorer) (void);
+  };
+# 230 "/usr/include/signal.h" 2 3 4
+
+
+extern int sigprocmask (int __how, const sigset_t *__restrict __set,
+   sigset_t *__restrict __oset) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+extern int sigsuspend (const sigset_t *__set) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigaction (int __sig, const struct sigaction *__restrict __act,
+        struct sigaction *__restrict __oact) __attribute__ ((__nothrow__ ));
+
+
+extern int sigpending (sigset_t *__set) __attribute__ ((__nothrow__ )) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int sigwait (const sigset_t *__restrict __set, int *__restrict __sig)
+     __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern int sigwaitinfo (const sigset_t *__restrict __set,
+   siginfo_t *__restrict __info) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int sigtimedwait (const sigset_t *__restrict __set,
+    siginfo_t *__restrict __info,
+    const struct timespec *__restrict __timeout)
+     __attribute__ ((__nonnull__ (1)));
+# 292 "/usr/include/signal.h" 3 4
+extern int sigqueue (__pid_t __pid, int __sig, const union sigval __val)
+     __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigcontext.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/sigcontext.h" 3 4
+struct _fpx_sw_bytes
+{
+  __uint32_t magic1;
+  __uint32_t extended_size;
+  __uint64_t xstate_bv;
+  __uint32_t xstate_size;
+  __uint32_t __glibc_reserved1[7];
+};
+
+struct _fpreg
+{
+  unsigned short significand[4];
+  unsigned short exponent;
+};
+
+struct _fpxreg
+{
+  unsigned short significand[4];
+  unsigned short exponent;
+  unsigned short __glibc_reserved1[3];
+};
+
+struct _xmmreg
+{
+  __uint32_t element[4];
+};
+# 123 "/usr/include/x86_64-linux-gnu/bits/sigcontext.h" 3 4
+struct _fpstate
+{
+
+  __uint16_t cwd;
+  __uint16_t swd;
+  __uint16_t ftw;
+  __uint16_t fop;
+  __uint64_t rip;
+  __uint64_t rdp;
+  __uint32_t mxcsr;
+  __uint32_t mxcr_mask;
+  struct _fpxreg _st[8];
+  struct _xmmreg _xmm[16];
+  __uint32_t __glibc_reserved1[24];
+};
+
+struct sigcontext
+{
+  __uint64_t r8;
+  __uint64_t r9;
+  __uint64_t r10;
+  __uint64_t r11;
+  __uint64_t r12;
+  __uint64_t r13;
+  __uint64_t r14;
+  __uint64_t r15;
+  __uint64_t rdi;
+  __uint64_t rsi;
+  __uint64_t rbp;
+  __uint64_t rbx;
+  __uint64_t rdx;
+  __uint64_t rax;
+  __uint64_t rcx;
+  __uint64_t rsp;
+  __uint64_t rip;
+  __uint64_t eflags;
+  unsigned short cs;
+  unsigned short gs;
+  unsigned short fs;
+  unsigned short __pad0;
+  __uint64_t err;
+  __uint64_t trapno;
+  __uint64_t oldmask;
+  __uint64_t cr2;
+  __extension__ union
+    {
+      struct _fpstate * fpstate;
+      __uint64_t __fpstate_word;
+    };
+  __uint64_t __reserved1 [8];
+};
+
+
+
+struct _xsave_hdr
+{
+  __uint64_t xstate_bv;
+  __uint64_t __glibc_reserved1[2];
+  __uint64_t __glibc_reserved2[5];
+};
+
+struct _ymmh_state
+{
+  __uint32_t ymmh_space[64];
+};
+
+struct _xstate
+{
+  struct _fpstate fpstate;
+  struct _xsave_hdr xstate_hdr;
+  struct _ymmh_state ymmh;
+};
+# 302 "/usr/include/signal.h" 2 3 4
+
+
+extern int sigreturn (struct sigcontext *__scp) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 312 "/usr/include/signal.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h" 2 3 4
+
+
+typedef struct
+  {
+    void *ss_sp;
+    int ss_flags;
+    size_t ss_size;
+  } stack_t;
+# 314 "/usr/include/signal.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/ucontext.h" 1 3 4
+# 37 "/usr/include/x86_64-linux-gnu/sys/ucontext.h" 3 4
+__extension__ typedef long long int greg_t;
+# 46 "/usr/include/x86_64-linux-gnu/sys/ucontext.h" 3 4
+typedef greg_t gregset_t[23];
+
+
+
+enum
+{
+  REG_R8 = 0,
+
+  REG_R9,
+
+  REG_R10,
+
+  REG_R11,
+
+  REG_R12,
+
+  REG_R13,
+
+  REG_R14,
+
+  REG_R15,
+
+  REG_RDI,
+
+  REG_RSI,
+
+  REG_RBP,
+
+  REG_RBX,
+
+  REG_RDX,
+
+  REG_RAX,
+
+  REG_RCX,
+
+  REG_RSP,
+
+  REG_RIP,
+
+  REG_EFL,
+
+  REG_CSGSFS,
+
+  REG_ERR,
+
+  REG_TRAPNO,
+
+  REG_OLDMASK,
+
+  REG_CR2
+
+};
+
+
+struct _libc_fpxreg
+{
+  unsigned short int significand[4];
+  unsigned short int exponent;
+  unsigned short int __glibc_reserved1[3];
+};
+
+struct _libc_xmmreg
+{
+  __uint32_t element[4];
+};
+
+struct _libc_fpstate
+{
+
+  __uint16_t cwd;
+  __uint16_t swd;
+  __uint16_t ftw;
+  __uint16_t fop;
+  __uint64_t rip;
+  __uint64_t rdp;
+  __uint32_t mxcsr;
+  __uint32_t mxcr_mask;
+  struct _libc_fpxreg _st[8];
+  struct _libc_xmmreg _xmm[16];
+  __uint32_t __glibc_reserved1[24];
+};
+
+
+typedef struct _libc_fpstate *fpregset_t;
+
+
+typedef struct
+  {
+    gregset_t gregs;
+
+    fpregset_t fpregs;
+    __extension__ unsigned long long __reserved1 [8];
+} mcontext_t;
+
+
+typedef struct ucontext_t
+  {
+    unsigned long int uc_flags;
+    struct ucontext_t *uc_link;
+    stack_t uc_stack;
+    mcontext_t uc_mcontext;
+    sigset_t uc_sigmask;
+    struct _libc_fpstate __fpregs_mem;
+    __extension__ unsigned long long int __ssp[4];
+  } ucontext_t;
+# 317 "/usr/include/signal.h" 2 3 4
+
+
+
+
+
+
+
+extern int siginterrupt (int __sig, int __interrupt) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__deprecated__));
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigstack.h" 1 3 4
+# 328 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigstksz.h" 1 3 4
+# 329 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/ss_flags.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/ss_flags.h" 3 4
+enum
+{
+  SS_ONSTACK = 1,
+
+  SS_DISABLE
+
+};
+# 330 "/usr/include/signal.h" 2 3 4
+
+
+
+extern int sigaltstack (const stack_t *__restrict __ss,
+   stack_t *__restrict __oss) __attribute__ ((__nothrow__ ));
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sigstack.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sigstack.h" 3 4
+struct sigstack
+  {
+    void *ss_sp;
+    int ss_onstack;
+  };
+# 340 "/usr/include/signal.h" 2 3 4
+
+
+
+
+
+
+
+extern int sigstack (struct sigstack *__ss, struct sigstack *__oss)
+     __attribute__ ((__nothrow__ )) __attribute__ ((__deprecated__));
+
+
+
+
+
+
+extern int sighold (int __sig) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__deprecated__));
+
+
+extern int sigrelse (int __sig) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__deprecated__));
+
+
+extern int sigignore (int __sig) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__deprecated__));
+
+
+extern __sighandler_t sigset (int __sig, __sighandler_t __disp) __attribute__ ((__nothrow__ ))
+  __attribute__ ((__deprecated__))
+                                                        ;
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigthread.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/sigthread.h" 3 4
+extern int pthread_sigmask (int __how,
+       const __sigset_t *__restrict __newmask,
+       __sigset_t *__restrict __oldmask)__attribute__ ((__nothrow__ ));
+
+
+extern int pthread_kill (pthread_t __threadid, int __signo) __attribute__ ((__nothrow__ ));
+
+
+
+extern int pthread_sigqueue (pthread_t __threadid, int __signo,
+        const union sigval __value) __attribute__ ((__nothrow__ ));
+# 377 "/usr/include/signal.h" 2 3 4
+
+
+
+
+
+
+extern int __libc_current_sigrtmin (void) __attribute__ ((__nothrow__ ));
+
+extern int __libc_current_sigrtmax (void) __attribute__ ((__nothrow__ ));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/signal_ext.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/signal_ext.h" 3 4
+extern int tgkill (__pid_t __tgid, __pid_t __tid, int __signal);
+# 392 "/usr/include/signal.h" 2 3 4
+
+
+# 37 "/usr/include/x86_64-linux-gnu/sys/wait.h" 2 3 4
+# 74 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/idtype_t.h" 1 3 4
+
+
+
+
+typedef enum
+{
+  P_ALL,
+  P_PID,
+  P_PGID,
+  P_PIDFD,
+
+} idtype_t;
+# 75 "/usr/include/x86_64-linux-gnu/sys/wait.h" 2 3 4
+# 83 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+extern __pid_t wait (int *__stat_loc);
+# 106 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+extern __pid_t waitpid (__pid_t __pid, int *__stat_loc, int __options);
+# 127 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+extern int waitid (idtype_t __idtype, __id_t __id, siginfo_t *__infop,
+     int __options);
+
+
+
+
+
+
+struct rusage;
+
+
+
+
+
+
+
+extern __pid_t wait3 (int *__stat_loc, int __options,
+        struct rusage * __usage) __attribute__ ((__nothrow__));
+# 159 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+extern __pid_t wait4 (__pid_t __pid, int *__stat_loc, int __options,
+        struct rusage *__usage) __attribute__ ((__nothrow__));
+# 173 "/usr/include/x86_64-linux-gnu/sys/wait.h" 3 4
+
+# 44 "compilewrap.c" 2
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/unistd.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/asm/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/unistd_64.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/asm/unistd.h" 2 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/syscall.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 2 3 4
+# 46 "compilewrap.c" 2
+# 57 "compilewrap.c"
+
+# 57 "compilewrap.c"
+static int DEBUG_LEVEL = 0;
+
+static int DEBUG_NO_LINE_DIRECTIVES = 0;
+# 119 "compilewrap.c"
+typedef struct {
+
+
+
+
+    pid_t pid;
+    int pipe;
+
+} Child;
+# 217 "compilewrap.c"
+extern char **environ;
+
+
+
+
+
+static int spawn_start(Child *child, char **argv, int out_0_err_1,
+                       int capture, const char *out_file, const char *dir)
+{
+    posix_spawn_file_actions_t actions;
+    int fds[2] = { -1, -1 };
+    int target = out_0_err_1 ? 
+# 228 "compilewrap.c" 3 4
+                              2 
+# 228 "compilewrap.c"
+                                            : 
+# 228 "compilewrap.c" 3 4
+                                              1
+# 228 "compilewrap.c"
+                                                           ;
+    int ret;
+
+
+    fflush(
+# 232 "compilewrap.c" 3 4
+          stdout
+# 232 "compilewrap.c"
+                );
+    child->pipe = -1;
+    if (capture) {
+
+        if (pipe2(fds, 
+# 236 "compilewrap.c" 3 4
+                      02000000
+# 236 "compilewrap.c"
+                               )) {
+
+
+
+
+            perror("pipe");
+            return -1;
+        }
+    }
+# 270 "compilewrap.c"
+    {
+        posix_spawn_file_actions_init(&actions);
+        if (capture)
+            posix_spawn_file_actions_adddup2(&actions, fds[1], target);
+        else if (out_file)
+            posix_spawn_file_actions_addopen(&actions, target, out_file,
+                                             
+# 276 "compilewrap.c" 3 4
+                                            01 
+# 276 "compilewrap.c"
+                                                     | 
+# 276 "compilewrap.c" 3 4
+                                                       0100 
+# 276 "compilewrap.c"
+                                                               | 
+# 276 "compilewrap.c" 3 4
+                                                                 01000
+# 276 "compilewrap.c"
+                                                                        , 0666);
+        if ((capture || out_file) && out_0_err_1 == 2)
+            posix_spawn_file_actions_adddup2(&actions, target, 
+# 278 "compilewrap.c" 3 4
+                                                              1
+# 278 "compilewrap.c"
+                                                                           );
+
+        if (dir)
+            posix_spawn_file_actions_addchdir_np(&actions, dir);
+
+        ret = posix_spawnp(&child->pid, argv[0], &actions, 
+# 283 "compilewrap.c" 3 4
+                                                          ((void *)0)
+# 283 "compilewrap.c"
+                                                              , argv, environ);
+        posix_spawn_file_actions_destroy(&actions);
+    }
+    if (capture)
+        close(fds[1]);
+    if (ret) {
+        fprintf(
+# 289 "compilewrap.c" 3 4
+               stderr
+# 289 "compilewrap.c"
+                     , "Unable to run %s: %s\n", argv[0], strerror(ret));
+        if (capture)
+            close(fds[0]);
+        return -1;
+    }
+    child->pipe = fds[0];
+
+    return 0;
+}
+
+static int spawn_read(Child *child, char *buf, size_t size)
+{
+    ssize_t n;
+
+    do {
+        n = read(child->pipe, buf, size);
+    } while (n < 0 && 
+# 305 "compilewrap.c" 3 4
+                     (*__errno_location ()) 
+# 305 "compilewrap.c"
+                           == 
+# 305 "compilewrap.c" 3 4
+                              4
+# 305 "compilewrap.c"
+                                   );
+
+    return n > 0 ? (int) n : 0;
+}
+
+static int spawn_wait(Child *child)
+{
+    int status;
+
+    if (child->pipe >= 0)
+        close(child->pipe);
+    while (waitpid(child->pid, &status, 0) < 0)
+        if (
+# 317 "compilewrap.c" 3 4
+           (*__errno_location ()) 
+# 317 "compilewrap.c"
+                 != 
+# 317 "compilewrap.c" 3 4
+                    4
+# 317 "compilewrap.c"
+                         )
+            return 1;
+
+    return 
+# 320 "compilewrap.c" 3 4
+          (((
+# 320 "compilewrap.c"
+          status
+# 320 "compilewrap.c" 3 4
+          ) & 0x7f) == 0) 
+# 320 "compilewrap.c"
+                            ? 
+# 320 "compilewrap.c" 3 4
+                              (((
+# 320 "compilewrap.c"
+                              status
+# 320 "compilewrap.c" 3 4
+                              ) & 0xff00) >> 8) 
+# 320 "compilewrap.c"
+                                                  : 1;
+}
+
+
+
+
+
+
+static int exec_argv_out(char **argv, int out_0_err_1, const char *out,
+                         const char *dir)
+{
+    Child child;
+
+    if (spawn_start(&child, argv, out_0_err_1, 0, out, dir))
+        return 1;
+
+    return spawn_wait(&child);
+}
+
+
+
+
+
+static int exec_argv_capture(char **argv, int out_0_err_1, char **buf,
+                             size_t *len, const char *dir)
+{
+    Child child;
+    size_t size = 65536;
+    int n;
+
+    *len = 0;
+    *buf = 
+# 351 "compilewrap.c" 3 4
+          ((void *)0)
+# 351 "compilewrap.c"
+              ;
+    if (spawn_start(&child, argv, out_0_err_1, 1, 
+# 352 "compilewrap.c" 3 4
+                                                 ((void *)0)
+# 352 "compilewrap.c"
+                                                     , dir))
+        return 1;
+    *buf = malloc(size);
+    while ((n = spawn_read(&child, *buf + *len, size - *len - 1)) > 0) {
+        *len += n;
+        if (size - *len < 4096) {
+            size *= 2;
+            *buf = realloc(*buf, size);
+        }
+    }
+    (*buf)[*len] = '\0';
+
+    return spawn_wait(&child);
+}
+
+
+
+int flagstrcmp ( const char * str1, const char * str2 )
+{
+    int realres = strcmp(str1, str2);
+    if (!realres)
+        return 0;
+    if ((str1[0] == '-' && str2[0] == '/') || (str1[0] == '/' && str2[0] == '-'))
+        return strcmp(str1+1, str2+1);
+    return realres;
+}
+
+
+
+int flagstrncmp ( const char * str1, const char * str2, size_t num )
+{
+    int realres = strncmp(str1, str2, num);
+    if (!realres)
+        return 0;
+    if ((str2[0] == '-' && str1[0] == '/') || (str2[0] == '/' && str1[0] == '-'))
+        return strncmp(str1+1, str2+1, num-1);
+    return realres;
+}
+# 399 "compilewrap.c"
+static int split_args(const char *p, int msvc, char **argv, char *out)
+{
+
+
+
+    int argc = 0;
+
+    for (;;) {
+        int quote = 0, escape = 0;
+
+        while (((*p) == ' ' || (*p) == '\t' || (*p) == '\r' || (*p) == '\n' || (*p) == '\f' || (*p) == '\v'))
+            p++;
+        if (!*p)
+            break;
+        if (argv)
+            argv[argc] = out;
+        argc++;
+
+        for (; *p && (quote || escape || !((*p) == ' ' || (*p) == '\t' || (*p) == '\r' || (*p) == '\n' || (*p) == '\f' || (*p) == '\v')); p++) {
+            if (msvc && *p == '\\') {
+
+                size_t i, n = 0;
+
+                while (p[n] == '\\')
+                    n++;
+                for (i = 0; i < (p[n] == '"' ? n / 2 : n); i++)
+                    do { if (out) *out++ = ('\\'); } while (0);
+                if (p[n] == '"' && (n & 1)) {
+                    do { if (out) *out++ = ('"'); } while (0);
+                    p += n;
+                } else {
+                    p += n - 1;
+                }
+            } else if (msvc && *p == '"') {
+
+                if (quote && p[1] == '"') {
+                    do { if (out) *out++ = ('"'); } while (0);
+                    p++;
+                } else {
+                    quote = !quote;
+                }
+            } else if (msvc) {
+                do { if (out) *out++ = (*p); } while (0);
+            } else if (escape) {
+                escape = 0;
+                do { if (out) *out++ = (*p); } while (0);
+            } else if (*p == '\\') {
+                escape = 1;
+            } else if (quote) {
+                if (*p == quote)
+                    quote = 0;
+                else
+                    do { if (out) *out++ = (*p); } while (0);
+            } else if (*p == '\'' || *p == '"') {
+                quote = *p;
+            } else {
+                do { if (out) *out++ = (*p); } while (0);
+            }
+        }
+        do { if (out) *out++ = ('\0'); } while (0);
+    }
+
+    return argc;
+
+
+}
+
+
+
+
+
+char **split_commandline(const char *cmdline, int msvc, int *argc)
+{
+    char **argv;
+
+    if (!cmdline)
+        return 
+# 475 "compilewrap.c" 3 4
+              ((void *)0)
+# 475 "compilewrap.c"
+                  ;
+
+
+    *argc = split_args(cmdline, msvc, 
+# 478 "compilewrap.c" 3 4
+                                     ((void *)0)
+# 478 "compilewrap.c"
+                                         , 
+# 478 "compilewrap.c" 3 4
+                                           ((void *)0)
+# 478 "compilewrap.c"
+                                               );
+    argv = malloc((*argc + 1) * sizeof(*argv) + strlen(cmdline) + 1);
+    if (!argv)
+        return 
+# 481 "compilewrap.c" 3 4
+              ((void *)0)
+# 481 "compilewrap.c"
+                  ;
+    split_args(cmdline, msvc, argv, (char *) (argv + *argc + 1));
+    argv[*argc] = 
+# 483 "compilewrap.c" 3 4
+                 ((void *)0)
+# 483 "compilewrap.c"
+                     ;
+
+    return argv;
+}
+
+
+
+static char * read_file_len(const char * filename, size_t * size) {
+    char * buf = 
+# 491 "compilewrap.c" 3 4
+                ((void *)0)
+# 491 "compilewrap.c"
+                    ;
+    long len;
+    FILE * f = fopen (filename, "rb");
+
+    if (f) {
+        fseek (f, 0, 
+# 496 "compilewrap.c" 3 4
+                    2
+# 496 "compilewrap.c"
+                            );
+        len = ftell (f);
+        fseek (f, 0, 
+# 498 "compilewrap.c" 3 4
+                    0
+# 498 "compilewrap.c"
+                            );
+        buf = malloc (len + 1);
+        if (buf != 
+# 500 "compilewrap.c" 3 4
+                  ((void *)0)
+# 500 "compilewrap.c"
+                      ) {
+            len = fread (buf, 1, len, f);
+            buf[len] = '\0';
+            *size = len;
+        }
+        fclose (f);
+    }
+    return buf;
+}
+
+
+char * read_file(const char * filename) {
+    size_t len;
+
+    return read_file_len(filename, &len);
+}
+
+
+void write_file(const char * buf, size_t len, const char * filename)
+{
+    if (strlen(buf) != len) {
+        printf("ERROR: Not saving all of file. strlen(buf)=%zd, asked to save len=%zd\n", strlen(buf), len);
+    }
+    FILE * f = fopen(filename, "wb");
+    fwrite (buf, 1, len, f);
+    fclose(f);
+}
+
+
+void print_argv(char * name, char ** argv, int argc, int force_print)
+{
+    int i, j;
+
+    if (DEBUG_LEVEL == 0 && force_print == 0) {
+        return;
+    }
+    (void)name;
+    for (i = 0; i < argc; i++) {
+        if (argv[i]) {
+            printf("%s ", argv[i]);
+        }
+    }
+}
+
+size_t remove_string(char * input, char * to_remove, size_t * initialsz)
+{
+    char * old_cursor = input;
+    char * cursor = strstr(input, to_remove);
+    size_t remain = strlen(input) + 1;
+    size_t finalsz = remain;
+    size_t to_remove_sz = strlen(to_remove);
+    *initialsz = remain;
+    while (cursor != 
+# 552 "compilewrap.c" 3 4
+                    ((void *)0)
+# 552 "compilewrap.c"
+                        ) {
+        size_t gap = cursor - old_cursor;
+        remain -= gap + to_remove_sz;
+        finalsz -= to_remove_sz;
+        memmove(cursor, cursor + to_remove_sz, remain);
+        old_cursor = cursor;
+        cursor = strstr(cursor, to_remove);
+    }
+    return finalsz;
+}
+# 571 "compilewrap.c"
+static void probe_compiler(char **argv, int *bits_32, int *major)
+{
+    static const char *env_vars[] = { "PATH", "INCLUDE", "LIB" };
+    const char *dir = getenv("C99_TO_C89_WRAP_CACHE_DIR");
+    char cache_file[2048] = "";
+    char *banner, *version;
+    size_t len;
+    FILE *f;
+    int i;
+
+    if (!dir || !dir[0])
+        dir = getenv("TEMP");
+    if (!dir || !dir[0])
+        dir = getenv("TMPDIR");
+    if (dir && dir[0]) {
+        unsigned long hash = 5381;
+        const char *p;
+
+        for (p = argv[0]; *p; p++)
+            hash = hash * 33 + (unsigned char) *p;
+        for (i = 0; i < (int) (sizeof(env_vars) / sizeof(env_vars[0])); i++) {
+            const char *val = getenv(env_vars[i]);
+            hash = hash * 33 + '\n';
+            for (p = val ? val : ""; *p; p++)
+                hash = hash * 33 + (unsigned char) *p;
+        }
+        snprintf(cache_file, sizeof(cache_file), "%s/c99wrap_%08lx.probe",
+                 dir, hash & 0xffffffffUL);
+        f = fopen(cache_file, "r");
+        if (f) {
+            int ok = fscanf(f, "%d %d", bits_32, major) == 2;
+            fclose(f);
+            if (ok)
+                return;
+        }
+    }
+
+    *bits_32 = 0;
+    *major = 0;
+
+    exec_argv_capture(argv, 2, &banner, &len, 
+# 611 "compilewrap.c" 3 4
+                                             ((void *)0)
+# 611 "compilewrap.c"
+                                                 );
+    if (!banner)
+        return;
+    if (strstr(banner, "80x86"))
+        *bits_32 = 1;
+
+    version = strstr(banner, "Version ");
+    if (version)
+        *major = (int) strtol(version + 8, 
+# 619 "compilewrap.c" 3 4
+                                          ((void *)0)
+# 619 "compilewrap.c"
+                                              , 10);
+    free(banner);
+
+
+    if (cache_file[0] && *major && (f = fopen(cache_file, "w"))) {
+        fprintf(f, "%d %d\n", *bits_32, *major);
+        fclose(f);
+    }
+}
+# 637 "compilewrap.c"
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+
+
+
+
+
+
+static unsigned cpu_count(void)
+{
+
+
+
+
+
+    long n = sysconf(
+# 652 "compilewrap.c" 3 4
+                    _SC_NPROCESSORS_ONLN
+# 652 "compilewrap.c"
+                                        );
+    return n > 0 ? (unsigned) n : 1;
+
+}
+
+typedef struct {
+    const char *conv_tool;
+    int keep, noconv;
+    const char *profile;
+    const char *dir;
+    const char *tag;
+    int probed;
+    int bits_32, cl_major;
+    const char *outname;
+
+    size_t preprocessed_size;
+    double t_preprocess, t_convert, t_compile;
+} WrapContext;
+
+static double get_time(void)
+{
+
+
+
+
+
+
+    struct timespec ts;
+    clock_gettime(
+# 680 "compilewrap.c" 3 4
+                 1
+# 680 "compilewrap.c"
+                                , &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+
+}
+# 694 "compilewrap.c"
+static struct {
+    int active;
+
+
+
+    int fd;
+
+} trace;
+
+static void trace_init(void)
+{
+    const char *path = getenv("C99_TO_C89_WRAP_TRACE");
+    char tmp[2048];
+    FILE *f;
+
+    if (!path || !path[0])
+        return;
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int) getpid());
+    f = fopen(tmp, "wb");
+    if (f) {
+        fputs("[\n", f);
+        fclose(f);
+
+
+
+
+        link(tmp, path);
+        unlink(tmp);
+
+    }
+
+
+
+
+
+
+
+    trace.fd = open(path, 
+# 731 "compilewrap.c" 3 4
+                         01 
+# 731 "compilewrap.c"
+                                  | 
+# 731 "compilewrap.c" 3 4
+                                    02000 
+# 731 "compilewrap.c"
+                                             | 
+# 731 "compilewrap.c" 3 4
+                                               0100 
+# 731 "compilewrap.c"
+                                                       | 
+# 731 "compilewrap.c" 3 4
+                                                         02000000
+# 731 "compilewrap.c"
+                                                                  , 0666);
+    trace.active = trace.fd >= 0;
+
+    if (!trace.active)
+        fprintf(
+# 735 "compilewrap.c" 3 4
+               stderr
+# 735 "compilewrap.c"
+                     , "Unable to open trace file %s\n", path);
+}
+
+
+static double trace_time(void)
+{
+    return trace.active ? get_time() : 0.0;
+}
+
+static unsigned long trace_tid(void)
+{
+
+
+
+    return (unsigned long) syscall(
+# 749 "compilewrap.c" 3 4
+                                  186
+# 749 "compilewrap.c"
+                                            );
+
+
+
+}
+
+
+static void trace_escape(char *buf, size_t size, const char *str)
+{
+    size_t n = 0;
+
+    for (; str && *str && n + 7 < size; str++) {
+        if (*str == '"' || *str == '\\') {
+            buf[n++] = '\\';
+            buf[n++] = *str;
+        } else if ((unsigned char) *str < 0x20) {
+            n += sprintf(buf + n, "\\u%04x", (unsigned char) *str);
+        } else {
+            buf[n++] = *str;
+        }
+    }
+    buf[n] = 0;
+}
+
+
+
+
+
+
+static void trace_event(const char *name, double start, double end,
+                        const char *outname, const char *file)
+{
+    char buf[8192], output[2048], input[2048];
+    int len;
+
+    if (!trace.active)
+        return;
+    trace_escape(output, sizeof(output), outname);
+    trace_escape(input, sizeof(input), file);
+    len = snprintf(buf, sizeof(buf),
+                   "{\"name\": \"%s\", \"cat\": \"c99wrap\", \"ph\": \"X\", "
+                   "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %lu, "
+                   "\"args\": {\"output\": \"%s\", \"file\": \"%s\"}},\n",
+                   name, start * 1e6, (end - start) * 1e6, (int) getpid(),
+                   trace_tid(), output, input);
+    if (len < 0 || len >= (int) sizeof(buf))
+        return;
+
+
+
+
+
+
+    if (write(trace.fd, buf, len) != len)
+        trace.active = 0;
+
+}
+
+static int is_absolute_path(const char *path)
+{
+    return path[0] == '/' || path[0] == '\\' ||
+           (path[0] && path[1] == ':');
+}
+
+
+
+
+
+static void temp_name(char *buf, size_t size, const WrapContext *ctx,
+                      const char *base, const char *suffix)
+{
+    if (ctx->dir && !is_absolute_path(base))
+        snprintf(buf, size, "%s/%s%s", ctx->dir, base, suffix);
+    else
+        snprintf(buf, size, "%s%s", base, suffix);
+}
+
+
+
+
+
+
+static char *decode_text(const char *buf, size_t len)
+{
+    const unsigned char *in = (const unsigned char *) buf;
+    int big_endian;
+    char *out;
+
+    if (len < 2 || !((in[0] == 0xff && in[1] == 0xfe) ||
+                     (in[0] == 0xfe && in[1] == 0xff))) {
+
+        if (len >= 3 && in[0] == 0xef && in[1] == 0xbb && in[2] == 0xbf) {
+            in += 3;
+            len -= 3;
+        }
+        out = malloc(len + 1);
+        if (out) {
+            memcpy(out, in, len);
+            out[len] = '\0';
+        }
+        return out;
+    }
+
+    big_endian = in[0] == 0xfe;
+    in += 2;
+    len = (len - 2) / 2;
+# 877 "compilewrap.c"
+    {
+        size_t i, pos = 0;
+
+
+        out = malloc(3 * len + 1);
+        if (!out)
+            return 
+# 883 "compilewrap.c" 3 4
+                  ((void *)0)
+# 883 "compilewrap.c"
+                      ;
+        for (i = 0; i < len; i++) {
+            unsigned long c = (big_endian ? in[2 * (i)] << 8 | in[2 * (i) + 1] : in[2 * (i) + 1] << 8 | in[2 * (i)]);
+
+            if (c >= 0xd800 && c < 0xdc00 && i + 1 < len &&
+                (big_endian ? in[2 * (i + 1)] << 8 | in[2 * (i + 1) + 1] : in[2 * (i + 1) + 1] << 8 | in[2 * (i + 1)]) >= 0xdc00 && (big_endian ? in[2 * (i + 1)] << 8 | in[2 * (i + 1) + 1] : in[2 * (i + 1) + 1] << 8 | in[2 * (i + 1)]) < 0xe000) {
+                c = 0x10000 + ((c - 0xd800) << 10) + ((big_endian ? in[2 * (i + 1)] << 8 | in[2 * (i + 1) + 1] : in[2 * (i + 1) + 1] << 8 | in[2 * (i + 1)]) - 0xdc00);
+                i++;
+            }
+            if (c < 0x80) {
+                out[pos++] = c;
+            } else if (c < 0x800) {
+                out[pos++] = 0xc0 | c >> 6;
+                out[pos++] = 0x80 | (c & 0x3f);
+            } else if (c < 0x10000) {
+                out[pos++] = 0xe0 | c >> 12;
+                out[pos++] = 0x80 | (c >> 6 & 0x3f);
+                out[pos++] = 0x80 | (c & 0x3f);
+            } else {
+                out[pos++] = 0xf0 | c >> 18;
+                out[pos++] = 0x80 | (c >> 12 & 0x3f);
+                out[pos++] = 0x80 | (c >> 6 & 0x3f);
+                out[pos++] = 0x80 | (c & 0x3f);
+            }
+        }
+        out[pos] = '\0';
+    }
+
+
+
+    return out;
+}
+# 926 "compilewrap.c"
+static char **expand_response_files(char **argv, int *argc, int msvc,
+                                    const char *dir, int depth)
+{
+    char ***files;
+    int *counts;
+    int i, j, n = 0, expanded = 0;
+    size_t size = 0;
+    char **out = argv, *str;
+
+    if (depth >= 16)
+        return argv;
+    files = calloc(*argc, sizeof(*files));
+    counts = calloc(*argc, sizeof(*counts));
+    for (i = 0; i < *argc; i++) {
+        if (argv[i][0] == '@' && argv[i][1]) {
+            char path[2048], *buf, *text;
+            size_t len;
+
+            if (dir && !is_absolute_path(argv[i] + 1))
+                snprintf(path, sizeof(path), "%s/%s", dir, argv[i] + 1);
+            else
+                snprintf(path, sizeof(path), "%s", argv[i] + 1);
+            if ((buf = read_file_len(path, &len))) {
+                text = decode_text(buf, len);
+                free(buf);
+                if (DEBUG_LEVEL > 1)
+                    printf("Response file contents:\n%s\n", text);
+                files[i] = split_commandline(text, msvc, &counts[i]);
+                free(text);
+            }
+        }
+        if (files[i]) {
+            char **sub = expand_response_files(files[i], &counts[i], msvc,
+                                               dir, depth + 1);
+            if (sub != files[i]) {
+                free(files[i]);
+                files[i] = sub;
+            }
+            for (j = 0; j < counts[i]; j++)
+                size += strlen(files[i][j]) + 1;
+            n += counts[i];
+            expanded = 1;
+        } else {
+            size += strlen(argv[i]) + 1;
+            n++;
+        }
+    }
+
+    if (expanded && (out = malloc((n + 1) * sizeof(*out) + size))) {
+        str = (char *) (out + n + 1);
+        n = 0;
+        for (i = 0; i < *argc; i++) {
+            char **src = files[i] ? files[i] : &argv[i];
+            int count = files[i] ? counts[i] : 1;
+
+            for (j = 0; j < count; j++) {
+                out[n++] = str;
+                strcpy(str, src[j]);
+                str += strlen(str) + 1;
+            }
+            free(files[i]);
+        }
+        out[n] = 
+# 988 "compilewrap.c" 3 4
+                ((void *)0)
+# 988 "compilewrap.c"
+                    ;
+        *argc = n;
+    } else {
+        for (i = 0; i < *argc; i++)
+            free(files[i]);
+        out = argv;
+    }
+    free(files);
+    free(counts);
+
+    return out;
+}
+static void make_dir(const char *path)
+{
+
+
+
+    mkdir(path, 0777);
+
+}
+
+static void remove_dir(const char *path)
+{
+
+
+
+    rmdir(path);
+
+}
+# 1032 "compilewrap.c"
+typedef struct {
+    int active;
+
+
+
+    int rfd, wfd;
+    char held[256];
+    int n_held;
+
+    int local, local_free;
+    int borrowed;
+    int max_weight;
+    size_t token_size;
+    unsigned seed;
+    Mutex lock;
+    Mutex gather;
+} Jobserver;
+
+static Jobserver jobserver;
+# 1059 "compilewrap.c"
+static void jobserver_init(void)
+{
+    const char *flags = getenv("MAKEFLAGS");
+    const char *envvar = getenv("C99_TO_C89_WRAP_TOKEN_SIZE");
+    const char *auth = 
+# 1063 "compilewrap.c" 3 4
+                      ((void *)0)
+# 1063 "compilewrap.c"
+                          , *ptr;
+    char value[1024];
+    size_t len;
+
+    pthread_mutex_init(&jobserver.lock, 
+# 1067 "compilewrap.c" 3 4
+   ((void *)0)
+# 1067 "compilewrap.c"
+   );
+    pthread_mutex_init(&jobserver.gather, 
+# 1068 "compilewrap.c" 3 4
+   ((void *)0)
+# 1068 "compilewrap.c"
+   );
+    jobserver.local = jobserver.local_free = 1;
+    jobserver.max_weight = 1;
+    jobserver.seed = (unsigned) getpid() ^ (unsigned) ((long long) (get_time() * 1000));
+
+    if (envvar) {
+        char *end;
+
+        jobserver.token_size = strtoul(envvar, &end, 10);
+        if (*end == 'k' || *end == 'K')
+            jobserver.token_size <<= 10;
+        else if (*end == 'm' || *end == 'M')
+            jobserver.token_size <<= 20;
+        else if (*end == 'g' || *end == 'G')
+            jobserver.token_size <<= 30;
+    }
+
+    if (!flags)
+        return;
+
+    for (ptr = flags; (ptr = strstr(ptr, "--jobserver-")); ptr++) {
+        if (!strncmp(ptr, "--jobserver-auth=", 17))
+            auth = ptr + 17;
+        else if (!strncmp(ptr, "--jobserver-fds=", 16))
+            auth = ptr + 16;
+    }
+    if (!auth)
+        return;
+    len = strcspn(auth, " ");
+    if (len >= sizeof(value))
+        return;
+    memcpy(value, auth, len);
+    value[len] = '\0';
+
+
+    if ((ptr = strstr(flags, "-j")) && (ptr == flags || ptr[-1] == ' ') &&
+        atoi(ptr + 2) > 1)
+        jobserver.max_weight = atoi(ptr + 2) / 2;
+    else
+        jobserver.max_weight = 1 << 16;
+
+
+
+
+
+    if (!strncmp(value, "fifo:", 5)) {
+        jobserver.rfd = open(value + 5, 
+# 1114 "compilewrap.c" 3 4
+                                       00 
+# 1114 "compilewrap.c"
+                                                | 
+# 1114 "compilewrap.c" 3 4
+                                                  04000
+# 1114 "compilewrap.c"
+                                                            );
+        jobserver.wfd = open(value + 5, 
+# 1115 "compilewrap.c" 3 4
+                                       01
+# 1115 "compilewrap.c"
+                                               );
+    } else {
+        char path[64];
+        int r, w;
+
+
+
+        if (sscanf(value, "%d,%d", &r, &w) != 2 || r < 0 || w < 0 ||
+            fcntl(r, 
+# 1123 "compilewrap.c" 3 4
+                    1
+# 1123 "compilewrap.c"
+                           ) < 0 || fcntl(w, 
+# 1123 "compilewrap.c" 3 4
+                                             1
+# 1123 "compilewrap.c"
+                                                    ) < 0) {
+            jobserver.max_weight = 1;
+            return;
+        }
+
+
+        snprintf(path, sizeof(path), "/proc/self/fd/%d", r);
+        jobserver.rfd = open(path, 
+# 1130 "compilewrap.c" 3 4
+                                  00 
+# 1130 "compilewrap.c"
+                                           | 
+# 1130 "compilewrap.c" 3 4
+                                             04000
+# 1130 "compilewrap.c"
+                                                       );
+        if (jobserver.rfd < 0)
+            jobserver.rfd = dup(r);
+        jobserver.wfd = dup(w);
+    }
+    jobserver.active = jobserver.rfd >= 0 && jobserver.wfd >= 0;
+
+    if (!jobserver.active)
+        jobserver.max_weight = 1;
+    if (DEBUG_LEVEL > 0)
+        printf("jobserver %s: %s\n", value, jobserver.active ? "on" : "unavailable");
+}
+
+
+static void jobserver_local(int n)
+{
+    pthread_mutex_lock(&jobserver.lock);
+    if (!jobserver.active && n > jobserver.local) {
+        jobserver.local_free += n - jobserver.local;
+        jobserver.local = jobserver.max_weight = n;
+    }
+    pthread_mutex_unlock(&jobserver.lock);
+}
+
+static void sleep_ms(int ms)
+{
+
+
+
+    usleep(ms * 1000);
+
+}
+
+
+static int jobserver_read(int ms)
+{
+# 1178 "compilewrap.c"
+    struct pollfd pfd;
+    char c;
+
+    if (!jobserver.active) {
+        sleep_ms(ms);
+        return 0;
+    }
+    pfd.fd = jobserver.rfd;
+    pfd.events = 
+# 1186 "compilewrap.c" 3 4
+                0x001
+# 1186 "compilewrap.c"
+                      ;
+    if (poll(&pfd, 1, ms) <= 0 || read(jobserver.rfd, &c, 1) != 1)
+        return 0;
+    pthread_mutex_lock(&jobserver.lock);
+    jobserver.borrowed++;
+    if (jobserver.n_held < (int) sizeof(jobserver.held))
+        jobserver.held[jobserver.n_held++] = c;
+    pthread_mutex_unlock(&jobserver.lock);
+    return 1;
+
+}
+
+
+static int jobserver_backoff(int attempt)
+{
+    jobserver.seed = jobserver.seed * 1103515245 + 12345;
+    return (jobserver.seed >> 16) % (50 << (attempt < 4 ? attempt : 4));
+}
+
+
+static void jobserver_write(int n)
+{
+    jobserver.borrowed -= n;
+    for (; n > 0; n--) {
+
+
+
+        char c = jobserver.n_held ? jobserver.held[--jobserver.n_held] : '+';
+        if (write(jobserver.wfd, &c, 1) != 1)
+            perror("jobserver");
+
+    }
+}
+
+static void jobserver_release(int n)
+{
+    pthread_mutex_lock(&jobserver.lock);
+    for (; n > 0 && jobserver.local_free < jobserver.local; n--)
+        jobserver.local_free++;
+    jobserver_write(n);
+    pthread_mutex_unlock(&jobserver.lock);
+}
+
+
+
+
+
+static int jobserver_acquire(int n)
+{
+    int got = 0, attempt = 0;
+    double deadline = 0, backoff = 0;
+
+    if (n > jobserver.max_weight)
+        n = jobserver.max_weight;
+    pthread_mutex_lock(&jobserver.gather);
+    for (;;) {
+        pthread_mutex_lock(&jobserver.lock);
+        while (got < n && jobserver.local_free > 0) {
+            jobserver.local_free--;
+            got++;
+        }
+        pthread_mutex_unlock(&jobserver.lock);
+        if (got >= n)
+            break;
+        if (got && !deadline)
+            deadline = get_time() + 5.0;
+        else if (got && get_time() > deadline)
+            break;
+
+        if (jobserver_read(got ? 50 : 10)) {
+            got++;
+            backoff = get_time() + 0.2;
+        } else if (got > 1 && get_time() > backoff) {
+
+            int back;
+
+            pthread_mutex_lock(&jobserver.lock);
+            back = got - 1 < jobserver.borrowed ? got - 1 : jobserver.borrowed;
+            jobserver_write(back);
+            jobserver.local_free += got - 1 - back;
+            pthread_mutex_unlock(&jobserver.lock);
+            got = 1;
+            sleep_ms(jobserver_backoff(attempt++));
+            backoff = get_time() + 0.2;
+        }
+    }
+    pthread_mutex_unlock(&jobserver.gather);
+
+    return got;
+}
+
+
+static int jobserver_weight(size_t size)
+{
+    if (!jobserver.token_size || size <= jobserver.token_size)
+        return 1;
+    return (int) ((size + jobserver.token_size - 1) / jobserver.token_size);
+}
+
+
+static int jobserver_acquire_traced(int n, const char *outname,
+                                    const char *file)
+{
+    double t0 = trace_time();
+    int tokens = jobserver_acquire(n);
+    double t1 = trace_time();
+
+    if (t1 - t0 > 0.001)
+        trace_event("wait for jobs", t0, t1, outname, file);
+    return tokens;
+}
+
+
+
+
+
+
+
+typedef struct {
+    const char *source;
+    char preprocessed[2048], converted[2048];
+    int cc_index;
+    int exit_code;
+    size_t preprocessed_size;
+    double t_preprocess, t_convert;
+} SourceJob;
+
+typedef struct {
+    SourceJob *sources;
+    int n_sources, next;
+    char **cpp_argv, **conv_argv;
+    int cpp_argc, conv_argc;
+    const WrapContext *ctx;
+    Mutex lock;
+} SourcePool;
+
+static void convert_source(const SourcePool *pool, SourceJob *src)
+{
+    const WrapContext *ctx = pool->ctx;
+    char **cpp_argv = malloc((pool->cpp_argc + 2) * sizeof(*cpp_argv));
+    char **conv_argv = malloc((pool->conv_argc + 3) * sizeof(*conv_argv));
+    char *preproc_out;
+    size_t preproc_len;
+    double t0, t1;
+    int tokens;
+
+    memcpy(cpp_argv, pool->cpp_argv, pool->cpp_argc * sizeof(*cpp_argv));
+    cpp_argv[pool->cpp_argc] = (char *) src->source;
+    cpp_argv[pool->cpp_argc + 1] = 
+# 1334 "compilewrap.c" 3 4
+                                  ((void *)0)
+# 1334 "compilewrap.c"
+                                      ;
+
+    print_argv("cpp_argv", cpp_argv, pool->cpp_argc + 2, 0);
+    tokens = jobserver_acquire_traced(1, ctx->outname, src->source);
+    t0 = get_time();
+    src->exit_code = exec_argv_capture(cpp_argv, 0, &preproc_out, &preproc_len,
+                                       ctx->dir);
+    t1 = get_time();
+    src->t_preprocess = t1 - t0;
+    trace_event("preprocess", t0, t1, ctx->outname, src->source);
+    jobserver_release(tokens);
+    if (src->exit_code) {
+        if (ctx->keep && preproc_out)
+            write_file(preproc_out, preproc_len, src->preprocessed);
+        free(preproc_out);
+
+        goto exit;
+    }
+# 1362 "compilewrap.c"
+    static char line_cont1[] = "\\\r\n";
+    static char line_cont2[] = "\\\n";
+
+    static char pragma_once1[] = "#pragma once\r\n";
+    static char pragma_once2[] = "#pragma once\n";
+    size_t initialsz;
+    t0 = trace_time();
+    size_t finalsz1 = remove_string(preproc_out, line_cont1, &initialsz);
+    t1 = trace_time();
+    trace_event("remove line continuations (CRLF)", t0, t1, ctx->outname,
+                src->source);
+    size_t finalsz2 = remove_string(preproc_out, line_cont2, &finalsz1);
+    t0 = trace_time();
+    trace_event("remove line continuations (LF)", t1, t0, ctx->outname,
+                src->source);
+    size_t finalsz3 = remove_string(preproc_out, pragma_once1, &finalsz2);
+    t1 = trace_time();
+    trace_event("remove #pragma once (CRLF)", t0, t1, ctx->outname,
+                src->source);
+    size_t finalsz4 = remove_string(preproc_out, pragma_once2, &finalsz3);
+    t0 = trace_time();
+    trace_event("remove #pragma once (LF)", t1, t0, ctx->outname,
+                src->source);
+    write_file(preproc_out, finalsz4 - 1, src->preprocessed);
+    src->preprocessed_size = finalsz4 - 1;
+    free(preproc_out);
+    trace_event("write preprocessed", t0, trace_time(), ctx->outname,
+                src->preprocessed);
+
+    memcpy(conv_argv, pool->conv_argv, pool->conv_argc * sizeof(*conv_argv));
+    conv_argv[pool->conv_argc] = src->preprocessed;
+    conv_argv[pool->conv_argc + 1] = src->converted;
+    conv_argv[pool->conv_argc + 2] = 
+# 1394 "compilewrap.c" 3 4
+                                    ((void *)0)
+# 1394 "compilewrap.c"
+                                        ;
+
+    tokens = jobserver_acquire_traced(jobserver_weight(src->preprocessed_size),
+                                      ctx->outname, src->preprocessed);
+    t0 = get_time();
+    src->exit_code = exec_argv_out(conv_argv, 0, 
+# 1399 "compilewrap.c" 3 4
+                                                ((void *)0)
+# 1399 "compilewrap.c"
+                                                    , ctx->dir);
+    t1 = get_time();
+    src->t_convert = t1 - t0;
+    trace_event("convert", t0, t1, ctx->outname, src->converted);
+    jobserver_release(tokens);
+    print_argv("conv_argv", conv_argv, pool->conv_argc + 2, 0);
+    if (src->exit_code && !ctx->keep)
+        unlink(src->converted);
+
+    if (!ctx->keep)
+        unlink(src->preprocessed);
+
+exit:
+    free(cpp_argv);
+    free(conv_argv);
+}
+
+
+
+
+static void *source_worker(void *arg)
+
+{
+    SourcePool *pool = arg;
+
+    for (;;) {
+        int n;
+
+        pthread_mutex_lock(&pool->lock);
+        n = pool->next < pool->n_sources ? pool->next++ : -1;
+        pthread_mutex_unlock(&pool->lock);
+        if (n < 0)
+            break;
+        convert_source(pool, &pool->sources[n]);
+    }
+
+    return 0;
+}
+
+
+static void convert_sources(SourcePool *pool, int n_threads)
+{
+    Thread *threads;
+    int n;
+
+    if (n_threads > pool->n_sources)
+        n_threads = pool->n_sources;
+    pool->next = 0;
+    jobserver_local(n_threads);
+    pthread_mutex_init(&pool->lock, 
+# 1448 "compilewrap.c" 3 4
+   ((void *)0)
+# 1448 "compilewrap.c"
+   );
+    if (n_threads <= 1) {
+        source_worker(pool);
+        pthread_mutex_destroy(&pool->lock);
+        return;
+    }
+
+    threads = malloc(n_threads * sizeof(*threads));
+    for (n = 0; n < n_threads; n++) {
+
+
+
+
+
+        if (pthread_create(&threads[n], 
+# 1462 "compilewrap.c" 3 4
+                                       ((void *)0)
+# 1462 "compilewrap.c"
+                                           , source_worker, pool)) {
+
+            fprintf(
+# 1464 "compilewrap.c" 3 4
+                   stderr
+# 1464 "compilewrap.c"
+                         , "Unable to create worker thread\n");
+            exit(1);
+        }
+    }
+    for (n = 0; n < n_threads; n++) {
+
+
+
+
+        pthread_join(threads[n], 
+# 1473 "compilewrap.c" 3 4
+                                ((void *)0)
+# 1473 "compilewrap.c"
+                                    );
+
+    }
+    pthread_mutex_destroy(&pool->lock);
+    free(threads);
+}
+
+
+
+
+
+static int wrap_command(int argc, char **argv, WrapContext *ctx)
+{
+    int i = 0;
+    int cpp_argc, cc_argc, pass_argc;
+    int exit_code;
+    int input_source = 0, input_obj = 0;
+    int msvc = 0, icl = 0, flag_compile = 0;
+    char temp_dir[2048] = "",
+         fo_buffer[2048], fi_buffer[2048], pid_name[64];
+    char **cpp_argv, **cc_argv, **pass_argv, **bitness_argv;
+    char *conv_argv[7];
+    SourceJob *sources;
+    SourcePool pool;
+    int n_sources = 0, n_threads = 0, tokens;
+    const char *compiler;
+    const char *outname = 
+# 1499 "compilewrap.c" 3 4
+                         ((void *)0)
+# 1499 "compilewrap.c"
+                             ;
+    const char *profile = ctx->profile;
+    char **response_argv;
+    char convert_options[20] = "";
+    char convert_bitness[4] = "-64";
+    char profile_option[64] = "";
+    int bits_32, cl_major, conv_argc;
+    double t0, t_probe = 0, t_probe_end = 0;
+
+
+    compiler = argv[0] + strlen(argv[0]);
+    while (compiler > argv[0] && compiler[-1] != '/' && compiler[-1] != '\\')
+        compiler--;
+    if (!strncmp(compiler, "cl", 2) && (compiler[2] == '.' || compiler[2] == '\0')) {
+        msvc = 1;
+        strcpy(convert_options, "-ms");
+    } else if (!strncmp(compiler, "icl", 3) && (compiler[3] == '.' || compiler[3] == '\0')) {
+        msvc = 1;
+        icl = 1;
+    }
+
+
+    response_argv = expand_response_files(argv, &argc, msvc, ctx->dir, 0);
+    if (response_argv != argv) {
+        argv = response_argv;
+        i = 0;
+
+
+
+        if (icl == 0)
+            printf("c99wrap cl ");
+        else
+            printf("c99wrap icl ");
+        print_argv("argv", argv + 1, argc - 1, 1);
+    } else {
+        response_argv = 
+# 1534 "compilewrap.c" 3 4
+                       ((void *)0)
+# 1534 "compilewrap.c"
+                           ;
+    }
+
+
+    cpp_argv = malloc((argc + 2) * sizeof(*cpp_argv));
+    cc_argv = malloc((argc + 3) * sizeof(*cc_argv));
+    pass_argv = malloc((argc + 3) * sizeof(*pass_argv));
+    sources = malloc(argc * sizeof(*sources));
+    bitness_argv = malloc(2 * sizeof(*bitness_argv));
+    if (icl)
+        bitness_argv[0] = "icl";
+    else
+        bitness_argv[0] = "cl";
+    bitness_argv[1] = 
+# 1547 "compilewrap.c" 3 4
+                     ((void *)0)
+# 1547 "compilewrap.c"
+                         ;
+    if (ctx->probed) {
+        bits_32 = ctx->bits_32;
+        cl_major = ctx->cl_major;
+    } else {
+        t_probe = trace_time();
+        probe_compiler(bitness_argv, &bits_32, &cl_major);
+        t_probe_end = trace_time();
+    }
+    if (bits_32)
+        strcpy(convert_bitness, "-32");
+
+    if (!profile && msvc && !icl)
+        profile = cl_major >= 19 ? "vs2015" : cl_major == 18 ? "vs2013" : 
+# 1560 "compilewrap.c" 3 4
+                                                                         ((void *)0)
+# 1560 "compilewrap.c"
+                                                                             ;
+    if (profile && profile[0])
+        snprintf(profile_option, sizeof(profile_option), "-profile=%s", profile);
+
+    cpp_argc = cc_argc = pass_argc = 0;
+
+    for (; i < argc; ) {
+        int len = strlen(argv[i]);
+        int ext_inputfile = 0;
+
+        if (len >= 2) {
+            const char *ext = &argv[i][len - 2];
+
+            if (!strcmp(ext, ".c") || !strcmp(ext, ".s") || !strcmp(ext, ".S")) {
+                ext_inputfile = 1;
+                input_source = 1;
+            } else if (!strcmp(ext, ".o") && argv[i][0] != '/' && argv[i][0] != '-') {
+                ext_inputfile = 2;
+                input_obj = 1;
+            }
+        }
+        if (!flagstrncmp(argv[i], "-Fo", 3) || !flagstrncmp(argv[i], "-Fi", 3) || !flagstrncmp(argv[i], "-Fe", 3) ||
+            !flagstrcmp(argv[i], "-out") || !flagstrcmp(argv[i], "-o") || !flagstrcmp(argv[i], "-FI")) {
+
+
+            if ((!flagstrcmp(argv[i], "-Fo") || !flagstrcmp(argv[i], "-out") || !flagstrcmp(argv[i], "-Fi") ||
+                !flagstrcmp(argv[i], "-Fe")) && i + 1 < argc) {
+
+
+
+                if (!flagstrcmp(argv[i], "-out"))
+                    sprintf(fo_buffer, "-out:%s", argv[i + 1]);
+                else
+                    sprintf(fo_buffer, "%s%s", argv[i], argv[i + 1]);
+
+                outname = argv[i + 1];
+
+                cc_argv[cc_argc++] = fo_buffer;
+                pass_argv[pass_argc++] = fo_buffer;
+
+                i += 2;
+            } else if (!flagstrcmp(argv[i], "-FI") && i + 1 < argc) {
+
+
+                sprintf(fi_buffer, "%s%s", argv[i], argv[i + 1]);
+
+                cpp_argv[cpp_argc++] = fi_buffer;
+                pass_argv[pass_argc++] = fi_buffer;
+
+                i += 2;
+            } else if (!flagstrncmp(argv[i], "-Fo", 3) || !flagstrncmp(argv[i], "-Fi", 3) || !flagstrncmp(argv[i], "-Fe", 3)) {
+                cc_argv[cc_argc++] = argv[i];
+                pass_argv[pass_argc++] = argv[i];
+
+                outname = argv[i] + 3;
+
+                i++;
+            } else {
+
+                pass_argv[pass_argc++] = argv[i];
+                cc_argv[cc_argc++] = argv[i++];
+
+                if (i < argc) {
+                    outname = argv[i];
+
+                    pass_argv[pass_argc++] = argv[i];
+                    cc_argv[cc_argc++] = argv[i++];
+                }
+            }
+
+        } else if (!flagstrcmp(argv[i], "-c")) {
+
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++] = argv[i++];
+
+            if (DEBUG_NO_LINE_DIRECTIVES == 0)
+                cpp_argv[cpp_argc++] = "-E";
+            else
+                cpp_argv[cpp_argc++] = "-EP";
+
+            if (!ctx->noconv)
+                flag_compile = 1;
+        } else if (ext_inputfile == 1) {
+
+            sources[n_sources].source = argv[i];
+            sources[n_sources].cc_index = cc_argc;
+            n_sources++;
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++] = argv[i++];
+        } else if (ext_inputfile == 2) {
+
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++] = argv[i++];
+        } else if (msvc && !flagstrncmp(argv[i], "-MP", 3)) {
+
+            n_threads = argv[i][3] ? atoi(argv[i] + 3) : 0;
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++] = argv[i++];
+        } else if (!flagstrcmp(argv[i], "-MMD") || !flagstrncmp(argv[i], "-D", 2)) {
+
+            if (!flagstrcmp(argv[i], "-D")) {
+
+                pass_argv[pass_argc++] = argv[i];
+                cpp_argv[cpp_argc++] = argv[i++];
+            }
+            pass_argv[pass_argc++] = argv[i];
+            cpp_argv[cpp_argc++] = argv[i++];
+        } else if (!flagstrcmp(argv[i], "-MF") || !flagstrcmp(argv[i], "-MT")) {
+
+            pass_argv[pass_argc++] = argv[i];
+            cpp_argv[cpp_argc++] = argv[i++];
+
+            if (i < argc) {
+                pass_argv[pass_argc++] = argv[i];
+                cpp_argv[cpp_argc++] = argv[i++];
+            }
+        } else if (!flagstrncmp(argv[i], "-FI", 3)) {
+
+            pass_argv[pass_argc++] = argv[i];
+            cpp_argv[cpp_argc++] = argv[i++];
+        } else {
+
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++] = argv[i];
+            cpp_argv[cpp_argc++] = argv[i];
+
+            i++;
+        }
+    }
+
+    cpp_argv[cpp_argc++] = 
+# 1690 "compilewrap.c" 3 4
+                            ((void *)0)
+# 1690 "compilewrap.c"
+                                ;
+    cc_argv[cc_argc++] = 
+# 1691 "compilewrap.c" 3 4
+                            ((void *)0)
+# 1691 "compilewrap.c"
+                                ;
+    pass_argv[pass_argc++] = 
+# 1692 "compilewrap.c" 3 4
+                            ((void *)0)
+# 1692 "compilewrap.c"
+                                ;
+
+    ctx->outname = outname ? outname : n_sources ? sources[0].source : 
+# 1694 "compilewrap.c" 3 4
+                                                                      ((void *)0)
+# 1694 "compilewrap.c"
+                                                                          ;
+    if (t_probe)
+        trace_event("probe compiler", t_probe, t_probe_end, ctx->outname,
+                    bitness_argv[0]);
+
+    if (!flag_compile || !n_sources || (n_sources == 1 && !outname)) {
+        print_argv("pass_argv", pass_argv, pass_argc, 0);
+
+        tokens = jobserver_acquire_traced(1, ctx->outname, 
+# 1702 "compilewrap.c" 3 4
+                                                          ((void *)0)
+# 1702 "compilewrap.c"
+                                                              );
+        t0 = trace_time();
+        exit_code = exec_argv_out(pass_argv, 0, 
+# 1704 "compilewrap.c" 3 4
+                                               ((void *)0)
+# 1704 "compilewrap.c"
+                                                   , ctx->dir);
+        trace_event("pass through", t0, trace_time(), ctx->outname, 
+# 1705 "compilewrap.c" 3 4
+                                                                   ((void *)0)
+# 1705 "compilewrap.c"
+                                                                       );
+        jobserver_release(tokens);
+
+        goto exit;
+    }
+
+    if (n_sources == 1 && outname[0] && !strchr("/\\", outname[strlen(outname) - 1])) {
+
+        temp_name(sources[0].preprocessed, sizeof(sources[0].preprocessed),
+                  ctx, outname, "_preprocessed.c");
+        temp_name(sources[0].converted, sizeof(sources[0].converted),
+                  ctx, outname, "_converted.c");
+    } else {
+
+
+
+        sprintf(pid_name, "c99wrap_%d%s", (int) getpid(), ctx->tag);
+        temp_name(temp_dir, sizeof(temp_dir), ctx, pid_name, "");
+        make_dir(temp_dir);
+        for (i = 0; i < n_sources; i++) {
+            const char *base = sources[i].source + strlen(sources[i].source);
+            while (base > sources[i].source && base[-1] != '/' && base[-1] != '\\')
+                base--;
+            snprintf(sources[i].converted, sizeof(sources[i].converted),
+                     "%s/%d", temp_dir, i);
+            make_dir(sources[i].converted);
+            snprintf(sources[i].preprocessed, sizeof(sources[i].preprocessed),
+                     "%s/%d/preprocessed_%s", temp_dir, i, base);
+            snprintf(sources[i].converted, sizeof(sources[i].converted),
+                     "%s/%d/%s", temp_dir, i, base);
+        }
+    }
+
+    conv_argc = 0;
+    conv_argv[conv_argc++] = (char *) ctx->conv_tool;
+    conv_argv[conv_argc++] = convert_options;
+    conv_argv[conv_argc++] = convert_bitness;
+    if (profile_option[0])
+        conv_argv[conv_argc++] = profile_option;
+
+    pool.sources = sources;
+    pool.n_sources = n_sources;
+    pool.cpp_argv = cpp_argv;
+    pool.cpp_argc = cpp_argc - 1;
+    pool.conv_argv = conv_argv;
+    pool.conv_argc = conv_argc;
+    pool.ctx = ctx;
+    convert_sources(&pool, n_threads > 0 ? n_threads : (int) cpu_count());
+
+    exit_code = 0;
+    for (i = 0; i < n_sources; i++) {
+        ctx->preprocessed_size += sources[i].preprocessed_size;
+        ctx->t_preprocess += sources[i].t_preprocess;
+        ctx->t_convert += sources[i].t_convert;
+        if (sources[i].exit_code && !exit_code)
+            exit_code = sources[i].exit_code;
+        cc_argv[sources[i].cc_index] = sources[i].converted;
+    }
+
+    if (!exit_code) {
+        tokens = jobserver_acquire_traced(1, ctx->outname, 
+# 1765 "compilewrap.c" 3 4
+                                                          ((void *)0)
+# 1765 "compilewrap.c"
+                                                              );
+        t0 = get_time();
+        exit_code = exec_argv_out(cc_argv, 0, 
+# 1767 "compilewrap.c" 3 4
+                                             ((void *)0)
+# 1767 "compilewrap.c"
+                                                 , ctx->dir);
+        ctx->t_compile = get_time() - t0;
+        trace_event("compile", t0, t0 + ctx->t_compile, ctx->outname, 
+# 1769 "compilewrap.c" 3 4
+                                                                     ((void *)0)
+# 1769 "compilewrap.c"
+                                                                         );
+        jobserver_release(tokens);
+    }
+
+    if (!ctx->keep) {
+        for (i = 0; i < n_sources; i++)
+            unlink(sources[i].converted);
+        if (temp_dir[0]) {
+            for (i = 0; i < n_sources; i++) {
+                snprintf(sources[i].converted, sizeof(sources[i].converted),
+                         "%s/%d", temp_dir, i);
+                remove_dir(sources[i].converted);
+            }
+            remove_dir(temp_dir);
+        }
+    }
+
+exit:
+    free(sources);
+    free(cc_argv);
+    free(cpp_argv);
+    free(pass_argv);
+    free(bitness_argv);
+    free(response_argv);
+
+    return exit_code ? 1 : 0;
+}
+# 1806 "compilewrap.c"
+typedef struct {
+    char *directory, *file;
+    char **argv;
+    int argc;
+    double estimate;
+    int worker, stolen, done;
+    int exit_code;
+    double start, seconds;
+    WrapContext ctx;
+    char tag[32];
+} CompdbJob;
+
+typedef struct {
+    Mutex lock;
+    unsigned *jobs;
+    unsigned head, tail;
+} JobDeque;
+
+typedef struct {
+    CompdbJob *jobs;
+    unsigned n_jobs;
+    JobDeque *deques;
+    unsigned n_workers;
+    const WrapContext *base;
+    const char *report;
+    Mutex lock;
+    unsigned n_done, n_failed;
+    double start, last_report;
+} Compdb;
+
+typedef struct {
+    const char *p, *end;
+    int error;
+} JsonParser;
+
+static void json_skip_space(JsonParser *j)
+{
+    while (j->p < j->end && (*j->p == ' ' || *j->p == '\t' ||
+                             *j->p == '\n' || *j->p == '\r'))
+        j->p++;
+}
+
+static int json_expect(JsonParser *j, char c)
+{
+    json_skip_space(j);
+    if (j->p < j->end && *j->p == c) {
+        j->p++;
+        return 1;
+    }
+    j->error = 1;
+    return 0;
+}
+
+
+static char *json_string(JsonParser *j)
+{
+    char *str, *d;
+
+    if (!json_expect(j, '"'))
+        return 
+# 1865 "compilewrap.c" 3 4
+              ((void *)0)
+# 1865 "compilewrap.c"
+                  ;
+
+    str = d = malloc(j->end - j->p + 1);
+    if (!str) {
+        j->error = 1;
+        return 
+# 1870 "compilewrap.c" 3 4
+              ((void *)0)
+# 1870 "compilewrap.c"
+                  ;
+    }
+    while (j->p < j->end && *j->p != '"') {
+        char c = *j->p++;
+        if (c == '\\' && j->p < j->end) {
+            c = *j->p++;
+            switch (c) {
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'u': {
+                unsigned u = 0;
+                int n;
+                for (n = 0; n < 4 && j->p < j->end; n++, j->p++) {
+                    char h = *j->p;
+                    u = u * 16 + (h >= 'a' ? h - 'a' + 10 :
+                                  h >= 'A' ? h - 'A' + 10 : h - '0');
+                }
+
+                if (u < 0x80) {
+                    *d++ = (char) u;
+                } else if (u < 0x800) {
+                    *d++ = (char) (0xc0 | (u >> 6));
+                    *d++ = (char) (0x80 | (u & 0x3f));
+                } else {
+                    *d++ = (char) (0xe0 | (u >> 12));
+                    *d++ = (char) (0x80 | ((u >> 6) & 0x3f));
+                    *d++ = (char) (0x80 | (u & 0x3f));
+                }
+                continue;
+            }
+            default: break;
+            }
+        }
+        *d++ = c;
+    }
+    *d = '\0';
+    if (!json_expect(j, '"')) {
+        free(str);
+        return 
+# 1911 "compilewrap.c" 3 4
+              ((void *)0)
+# 1911 "compilewrap.c"
+                  ;
+    }
+    return str;
+}
+
+static void json_skip_value(JsonParser *j)
+{
+    json_skip_space(j);
+    if (j->p == j->end) {
+        j->error = 1;
+    } else if (*j->p == '"') {
+        free(json_string(j));
+    } else if (*j->p == '[' || *j->p == '{') {
+        char close = *j->p == '[' ? ']' : '}';
+        j->p++;
+        json_skip_space(j);
+        if (j->p < j->end && *j->p == close) {
+            j->p++;
+            return;
+        }
+        while (!j->error) {
+            if (close == '}') {
+                free(json_string(j));
+                json_expect(j, ':');
+            }
+            json_skip_value(j);
+            json_skip_space(j);
+            if (j->p < j->end && *j->p == ',')
+                j->p++;
+            else
+                break;
+        }
+        json_expect(j, close);
+    } else {
+
+        while (j->p < j->end && !strchr(",]} \t\r\n", *j->p))
+            j->p++;
+    }
+}
+
+
+
+
+
+static void json_object(JsonParser *j,
+                        void (*member)(JsonParser *j, const char *key,
+                                       void *opaque),
+                        void *opaque)
+{
+    if (!json_expect(j, '{'))
+        return;
+    json_skip_space(j);
+    if (j->p < j->end && *j->p == '}') {
+        j->p++;
+        return;
+    }
+    while (!j->error) {
+        char *key = json_string(j);
+        if (!key || !json_expect(j, ':')) {
+            free(key);
+            return;
+        }
+        member(j, key, opaque);
+        free(key);
+        json_skip_space(j);
+        if (j->p < j->end && *j->p == ',')
+            j->p++;
+        else
+            break;
+    }
+    json_expect(j, '}');
+}
+
+
+static void json_array(JsonParser *j,
+                       void (*element)(JsonParser *j, void *opaque),
+                       void *opaque)
+{
+    if (!json_expect(j, '['))
+        return;
+    json_skip_space(j);
+    if (j->p < j->end && *j->p == ']') {
+        j->p++;
+        return;
+    }
+    while (!j->error) {
+        element(j, opaque);
+        json_skip_space(j);
+        if (j->p < j->end && *j->p == ',')
+            j->p++;
+        else
+            break;
+    }
+    json_expect(j, ']');
+}
+
+static void write_json_string(FILE *f, const char *str)
+{
+    fputc('"', f);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            fprintf(f, "\\%c", *str);
+        else if ((unsigned char) *str < 0x20)
+            fprintf(f, "\\u%04x", (unsigned char) *str);
+        else
+            fputc(*str, f);
+    }
+    fputc('"', f);
+}
+
+typedef struct {
+    CompdbJob job;
+    char *command;
+} EntryParser;
+
+static void parse_argument(JsonParser *j, void *opaque)
+{
+    CompdbJob *job = opaque;
+    char *arg = json_string(j);
+    char **mem;
+
+    if (!arg)
+        return;
+    mem = realloc(job->argv, (job->argc + 2) * sizeof(*job->argv));
+    if (!mem) {
+        j->error = 1;
+        free(arg);
+        return;
+    }
+    job->argv = mem;
+    job->argv[job->argc++] = arg;
+    job->argv[job->argc] = 
+# 2042 "compilewrap.c" 3 4
+                          ((void *)0)
+# 2042 "compilewrap.c"
+                              ;
+}
+
+static void parse_entry_member(JsonParser *j, const char *key, void *opaque)
+{
+    EntryParser *e = opaque;
+
+    if (!strcmp(key, "directory")) {
+        free(e->job.directory);
+        e->job.directory = json_string(j);
+    } else if (!strcmp(key, "file")) {
+        free(e->job.file);
+        e->job.file = json_string(j);
+    } else if (!strcmp(key, "command")) {
+        free(e->command);
+        e->command = json_string(j);
+    } else if (!strcmp(key, "arguments")) {
+        json_array(j, parse_argument, &e->job);
+    } else {
+        json_skip_value(j);
+    }
+}
+
+static void parse_entry(JsonParser *j, void *opaque)
+{
+    Compdb *db = opaque;
+    EntryParser e;
+    CompdbJob *mem;
+
+    memset(&e, 0, sizeof(e));
+    json_object(j, parse_entry_member, &e);
+    if (!e.job.argv && e.command) {
+
+
+
+
+        e.job.argv = split_commandline(e.command, 0, &e.job.argc);
+
+    }
+    free(e.command);
+    if (j->error || !e.job.argv || !e.job.argc || !e.job.directory ||
+        !e.job.file) {
+        fprintf(
+# 2084 "compilewrap.c" 3 4
+               stderr
+# 2084 "compilewrap.c"
+                     , "Ignoring incomplete compile_commands.json entry\n");
+        return;
+    }
+
+    mem = realloc(db->jobs, (db->n_jobs + 1) * sizeof(*db->jobs));
+    if (!mem) {
+        j->error = 1;
+        return;
+    }
+    db->jobs = mem;
+    db->jobs[db->n_jobs++] = e.job;
+}
+
+typedef struct {
+    char *directory, *file;
+    double preprocessed_size;
+} ReportEntry;
+
+static void parse_report_member(JsonParser *j, const char *key, void *opaque)
+{
+    ReportEntry *r = opaque;
+
+    if (!strcmp(key, "directory")) {
+        r->directory = json_string(j);
+    } else if (!strcmp(key, "file")) {
+        r->file = json_string(j);
+    } else if (!strcmp(key, "preprocessed_size")) {
+        json_skip_space(j);
+        r->preprocessed_size = strtod(j->p, 
+# 2112 "compilewrap.c" 3 4
+                                           ((void *)0)
+# 2112 "compilewrap.c"
+                                               );
+        json_skip_value(j);
+    } else {
+        json_skip_value(j);
+    }
+}
+
+static void parse_report_file(JsonParser *j, void *opaque)
+{
+    Compdb *db = opaque;
+    ReportEntry r;
+    unsigned n;
+
+    memset(&r, 0, sizeof(r));
+    json_object(j, parse_report_member, &r);
+    for (n = 0; r.directory && r.file && r.preprocessed_size > 0 &&
+                n < db->n_jobs; n++) {
+        CompdbJob *job = &db->jobs[n];
+        if (!strcmp(job->directory, r.directory) && !strcmp(job->file, r.file))
+            job->estimate = r.preprocessed_size;
+    }
+    free(r.directory);
+    free(r.file);
+}
+
+static void parse_report_member_top(JsonParser *j, const char *key,
+                                    void *opaque)
+{
+    if (!strcmp(key, "files"))
+        json_array(j, parse_report_file, opaque);
+    else
+        json_skip_value(j);
+}
+
+
+static void estimate_jobs(Compdb *db)
+{
+    char *report = db->report ? read_file(db->report) : 
+# 2149 "compilewrap.c" 3 4
+                                                       ((void *)0)
+# 2149 "compilewrap.c"
+                                                           ;
+    unsigned n;
+
+    if (report) {
+        JsonParser j = { report, report + strlen(report), 0 };
+        json_object(&j, parse_report_member_top, db);
+        free(report);
+    }
+    for (n = 0; n < db->n_jobs; n++) {
+        CompdbJob *job = &db->jobs[n];
+        char path[4096];
+        struct stat st;
+
+        if (job->estimate > 0)
+            continue;
+        if (is_absolute_path(job->file))
+            snprintf(path, sizeof(path), "%s", job->file);
+        else
+            snprintf(path, sizeof(path), "%s/%s", job->directory, job->file);
+        job->estimate = stat(path, &st) ? 0 : (double) st.st_size;
+    }
+}
+
+
+static void write_report(Compdb *db, int finished)
+{
+    char tmp[4096];
+    unsigned n;
+    FILE *f;
+
+    snprintf(tmp, sizeof(tmp), "%s.tmp", db->report);
+    if (!(f = fopen(tmp, "w"))) {
+        perror(tmp);
+        return;
+    }
+    fprintf(f, "{\n  \"finished\": %s,\n  \"jobs\": %u,\n  \"workers\": %u,\n"
+            "  \"done\": %u,\n  \"failed\": %u,\n  \"seconds\": %.3f,\n"
+            "  \"files\": [", finished ? "true" : "false", db->n_jobs,
+            db->n_workers, db->n_done, db->n_failed, get_time() - db->start);
+    for (n = 0; n < db->n_jobs; n++) {
+        CompdbJob *job = &db->jobs[n];
+
+        fprintf(f, "%s\n    { \"file\": ", n ? "," : "");
+        write_json_string(f, job->file);
+        fprintf(f, ", \"directory\": ");
+        write_json_string(f, job->directory);
+        if (!job->done) {
+            fprintf(f, ", \"status\": \"%s\" }", job->start > 0 ? "running" : "queued");
+            continue;
+        }
+        fprintf(f, ", \"status\": \"done\", \"exit_code\": %d, "
+                "\"preprocessed_size\": %lu, \"start\": %.3f, \"seconds\": %.3f, "
+                "\"preprocess_seconds\": %.3f, \"convert_seconds\": %.3f, "
+                "\"compile_seconds\": %.3f, \"worker\": %d, \"stolen\": %s }",
+                job->exit_code, (unsigned long) job->ctx.preprocessed_size,
+                job->start - db->start, job->seconds, job->ctx.t_preprocess,
+                job->ctx.t_convert, job->ctx.t_compile, job->worker,
+                job->stolen ? "true" : "false");
+    }
+    fprintf(f, "\n  ]\n}\n");
+    fclose(f);
+
+
+
+    if (rename(tmp, db->report))
+
+        perror(db->report);
+}
+
+
+static CompdbJob *next_job(Compdb *db, unsigned w)
+{
+    JobDeque *own = &db->deques[w];
+    unsigned n, victim = (unsigned) -1;
+    double longest = -1;
+    CompdbJob *job = 
+# 2224 "compilewrap.c" 3 4
+                    ((void *)0)
+# 2224 "compilewrap.c"
+                        ;
+
+    pthread_mutex_lock(&own->lock);
+    if (own->head < own->tail)
+        job = &db->jobs[own->jobs[own->head++]];
+    pthread_mutex_unlock(&own->lock);
+    if (job)
+        return job;
+
+
+    for (n = 0; n < db->n_workers; n++) {
+        JobDeque *d = &db->deques[n];
+        if (n != w && d->head < d->tail &&
+            db->jobs[d->jobs[d->head]].estimate > longest) {
+            longest = db->jobs[d->jobs[d->head]].estimate;
+            victim = n;
+        }
+    }
+    if (victim == (unsigned) -1)
+        return 
+# 2243 "compilewrap.c" 3 4
+              ((void *)0)
+# 2243 "compilewrap.c"
+                  ;
+    pthread_mutex_lock(&db->deques[victim].lock);
+    if (db->deques[victim].head < db->deques[victim].tail) {
+        job = &db->jobs[db->deques[victim].jobs[db->deques[victim].head++]];
+        job->stolen = 1;
+    }
+    pthread_mutex_unlock(&db->deques[victim].lock);
+
+
+    return job ? job : next_job(db, w);
+}
+
+typedef struct {
+    Compdb *db;
+    unsigned index;
+} Worker;
+
+
+
+
+static void *compdb_worker(void *arg)
+
+{
+    Worker *worker = arg;
+    Compdb *db = worker->db;
+    CompdbJob *job;
+
+    while ((job = next_job(db, worker->index))) {
+        pthread_mutex_lock(&db->lock);
+        job->start = get_time();
+        job->worker = worker->index;
+        pthread_mutex_unlock(&db->lock);
+
+        job->ctx = *db->base;
+        job->ctx.dir = job->directory;
+        snprintf(job->tag, sizeof(job->tag), "_%u", (unsigned) (job - db->jobs));
+        job->ctx.tag = job->tag;
+        job->exit_code = wrap_command(job->argc, job->argv, &job->ctx);
+
+        pthread_mutex_lock(&db->lock);
+        job->seconds = get_time() - job->start;
+        job->done = 1;
+        db->n_done++;
+        db->n_failed += job->exit_code != 0;
+        printf("[%u/%u] %s%s (%.2fs)\n", db->n_done, db->n_jobs, job->file,
+               job->exit_code ? " FAILED" : "", job->seconds);
+        fflush(
+# 2289 "compilewrap.c" 3 4
+              stdout
+# 2289 "compilewrap.c"
+                    );
+        if (db->report && get_time() - db->last_report >= 1.0) {
+            write_report(db, 0);
+            db->last_report = get_time();
+        }
+        pthread_mutex_unlock(&db->lock);
+    }
+
+    return 0;
+}
+
+static const CompdbJob *sort_jobs;
+
+
+static int compare_jobs(const void *a, const void *b)
+{
+    double x = sort_jobs[*(const unsigned *) a].estimate;
+    double y = sort_jobs[*(const unsigned *) b].estimate;
+
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static int run_compdb(const char *file, unsigned n_workers,
+                      const char *report, WrapContext *base)
+{
+    Compdb db;
+    Worker *workers;
+    Thread *threads;
+    unsigned *order, n;
+    char *json = read_file(file);
+    JsonParser j;
+
+    if (!json) {
+        fprintf(
+# 2322 "compilewrap.c" 3 4
+               stderr
+# 2322 "compilewrap.c"
+                     , "Unable to read %s\n", file);
+        return 1;
+    }
+    memset(&db, 0, sizeof(db));
+    db.report = report;
+    j.p = json;
+    j.end = json + strlen(json);
+    j.error = 0;
+    json_array(&j, parse_entry, &db);
+    free(json);
+    if (j.error) {
+        fprintf(
+# 2333 "compilewrap.c" 3 4
+               stderr
+# 2333 "compilewrap.c"
+                     , "Unable to parse %s\n", file);
+        return 1;
+    }
+    if (!db.n_jobs)
+        return 0;
+    if (n_workers < 1)
+        n_workers = cpu_count();
+    if (n_workers > db.n_jobs)
+        n_workers = db.n_jobs;
+    db.n_workers = n_workers;
+    jobserver_local(n_workers);
+
+
+    if (!base->probed) {
+        char *probe_argv[2];
+        const char *compiler = db.jobs[0].argv[0];
+        const char *base_name = compiler + strlen(compiler);
+        while (base_name > compiler && base_name[-1] != '/' && base_name[-1] != '\\')
+            base_name--;
+        probe_argv[0] = strncmp(base_name, "icl", 3) ? "cl" : "icl";
+        probe_argv[1] = 
+# 2353 "compilewrap.c" 3 4
+                       ((void *)0)
+# 2353 "compilewrap.c"
+                           ;
+        probe_compiler(probe_argv, &base->bits_32, &base->cl_major);
+        base->probed = 1;
+    }
+    db.base = base;
+
+    estimate_jobs(&db);
+    order = malloc(db.n_jobs * sizeof(*order));
+    db.deques = calloc(n_workers, sizeof(*db.deques));
+    workers = calloc(n_workers, sizeof(*workers));
+    threads = calloc(n_workers, sizeof(*threads));
+    if (!order || !db.deques || !workers || !threads) {
+        fprintf(
+# 2365 "compilewrap.c" 3 4
+               stderr
+# 2365 "compilewrap.c"
+                     , "Out of memory\n");
+        return 1;
+    }
+    for (n = 0; n < db.n_jobs; n++)
+        order[n] = n;
+    sort_jobs = db.jobs;
+    qsort(order, db.n_jobs, sizeof(*order), compare_jobs);
+
+
+    for (n = 0; n < n_workers; n++) {
+        pthread_mutex_init(&db.deques[n].lock, 
+# 2375 "compilewrap.c" 3 4
+       ((void *)0)
+# 2375 "compilewrap.c"
+       );
+        db.deques[n].jobs = malloc((db.n_jobs / n_workers + 1) * sizeof(unsigned));
+        if (!db.deques[n].jobs) {
+            fprintf(
+# 2378 "compilewrap.c" 3 4
+                   stderr
+# 2378 "compilewrap.c"
+                         , "Out of memory\n");
+            return 1;
+        }
+    }
+    for (n = 0; n < db.n_jobs; n++) {
+        JobDeque *d = &db.deques[n % n_workers];
+        d->jobs[d->tail++] = order[n];
+    }
+
+    pthread_mutex_init(&db.lock, 
+# 2387 "compilewrap.c" 3 4
+   ((void *)0)
+# 2387 "compilewrap.c"
+   );
+    db.start = db.last_report = get_time();
+    for (n = 0; n < n_workers; n++) {
+        workers[n].db = &db;
+        workers[n].index = n;
+
+
+
+
+
+        if (pthread_create(&threads[n], 
+# 2397 "compilewrap.c" 3 4
+                                       ((void *)0)
+# 2397 "compilewrap.c"
+                                           , compdb_worker, &workers[n])) {
+
+            fprintf(
+# 2399 "compilewrap.c" 3 4
+                   stderr
+# 2399 "compilewrap.c"
+                         , "Unable to create worker thread\n");
+            exit(1);
+        }
+    }
+    for (n = 0; n < n_workers; n++) {
+
+
+
+
+        pthread_join(threads[n], 
+# 2408 "compilewrap.c" 3 4
+                                ((void *)0)
+# 2408 "compilewrap.c"
+                                    );
+
+    }
+
+    if (report)
+        write_report(&db, 1);
+    printf("%u of %u files failed, %.2fs on %u workers\n", db.n_failed,
+           db.n_jobs, get_time() - db.start, n_workers);
+
+    for (n = 0; n < n_workers; n++) {
+        pthread_mutex_destroy(&db.deques[n].lock);
+        free(db.deques[n].jobs);
+    }
+    pthread_mutex_destroy(&db.lock);
+    free(db.deques);
+    free(workers);
+    free(threads);
+    free(order);
+
+    return db.n_failed ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int i = 1;
+    char *ptr, *conv_tool;
+    const char *envvar = 
+# 2434 "compilewrap.c" 3 4
+                        ((void *)0)
+# 2434 "compilewrap.c"
+                            ;
+    const char *compdb = 
+# 2435 "compilewrap.c" 3 4
+                        ((void *)0)
+# 2435 "compilewrap.c"
+                            , *report = 
+# 2435 "compilewrap.c" 3 4
+                                        ((void *)0)
+# 2435 "compilewrap.c"
+                                            ;
+    unsigned n_workers = 0;
+    WrapContext ctx;
+    int ret;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.tag = "";
+
+    conv_tool = malloc(strlen(argv[0]) + strlen("c99conv") + 1);
+    strcpy(conv_tool, argv[0]);
+
+    envvar = getenv("C99_TO_C89_WRAP_DEBUG_LEVEL");
+    if (envvar != 
+# 2447 "compilewrap.c" 3 4
+                 ((void *)0)
+# 2447 "compilewrap.c"
+                     ) {
+        DEBUG_LEVEL = strtoll(envvar, 
+# 2448 "compilewrap.c" 3 4
+                                     ((void *)0)
+# 2448 "compilewrap.c"
+                                         , 10);
+        envvar = 
+# 2449 "compilewrap.c" 3 4
+                ((void *)0)
+# 2449 "compilewrap.c"
+                    ;
+    }
+    envvar = getenv("C99_TO_C89_WRAP_SAVE_TEMPS");
+    if (envvar != 
+# 2452 "compilewrap.c" 3 4
+                 ((void *)0)
+# 2452 "compilewrap.c"
+                     ) {
+        ctx.keep = strtoll(envvar, 
+# 2453 "compilewrap.c" 3 4
+                                  ((void *)0)
+# 2453 "compilewrap.c"
+                                      , 10);
+        envvar = 
+# 2454 "compilewrap.c" 3 4
+                ((void *)0)
+# 2454 "compilewrap.c"
+                    ;
+    }
+    envvar = getenv("C99_TO_C89_WRAP_NO_LINE_DIRECTIVES");
+    if (envvar != 
+# 2457 "compilewrap.c" 3 4
+                 ((void *)0)
+# 2457 "compilewrap.c"
+                     ) {
+        DEBUG_NO_LINE_DIRECTIVES = strtoll(envvar, 
+# 2458 "compilewrap.c" 3 4
+                                                  ((void *)0)
+# 2458 "compilewrap.c"
+                                                      , 10);
+        envvar = 
+# 2459 "compilewrap.c" 3 4
+                ((void *)0)
+# 2459 "compilewrap.c"
+                    ;
+    }
+
+    ctx.profile = getenv("C99_TO_C89_WRAP_PROFILE");
+
+    ptr = strrchr(conv_tool, '\\');
+    if (!ptr)
+        ptr = strrchr(conv_tool, '/');
+
+    if (!ptr)
+        conv_tool[0] = '\0';
+    else
+        ptr[1] = '\0';
+    strcat(conv_tool, "c99conv");
+    ctx.conv_tool = conv_tool;
+
+
+
+    jobserver_init();
+    trace_init();
+
+    for (; i < argc; i++) {
+        if (!strcmp(argv[i], "-keep")) {
+            ctx.keep = 1;
+        } else if (!strcmp(argv[i], "-noconv")) {
+            ctx.noconv = 1;
+        } else if (!strncmp(argv[i], "-profile=", 9)) {
+            ctx.profile = argv[i] + 9;
+        } else if (!strcmp(argv[i], "--compdb") && i + 1 < argc) {
+            compdb = argv[++i];
+        } else if (!strcmp(argv[i], "--report") && i + 1 < argc) {
+            report = argv[++i];
+        } else if (!strncmp(argv[i], "-j", 2)) {
+            n_workers = (unsigned) strtoul(argv[i][2] ? &argv[i][2] :
+                                           i + 1 < argc ? argv[++i] : "0",
+                                           
+# 2494 "compilewrap.c" 3 4
+                                          ((void *)0)
+# 2494 "compilewrap.c"
+                                              , 10);
+        } else
+            break;
+    }
+
+    if (ctx.keep && ctx.noconv) {
+        fprintf(
+# 2500 "compilewrap.c" 3 4
+               stderr
+# 2500 "compilewrap.c"
+                     , "Using -keep with -noconv doesn't make any sense!\n "
+                        "You cannot keep intermediate files that doesn't exist.\n");
+        return 1;
+    }
+
+    if (compdb) {
+        ret = run_compdb(compdb, n_workers, report, &ctx);
+    } else if (i < argc) {
+        ret = wrap_command(argc - i, argv + i, &ctx);
+    } else {
+        fprintf(
+# 2510 "compilewrap.c" 3 4
+               stderr
+# 2510 "compilewrap.c"
+                     , "%s [-keep|-noconv] [-profile=<name>] cl|icl <args>\n"
+                "%s [-keep|-noconv] [-profile=<name>] --compdb "
+                "compile_commands.json [-j <n>] [--report <report.json>]\n",
+                argv[0], argv[0]);
+        ret = 1;
+    }
+    free(conv_tool);
+
+    return ret;
+}
@@ -0,0 +1,215 @@
+/*
+ * Applier for the edit lists written by c99conv -edits
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Writes the input with the edits applied, in one pass over it. The edit
+ * list is the JSON object written by c99conv:
+ *
+ *   {"input": "<name>", "size": <input size>, "edits": [
+ *   {"offset": <offset>, "length": <length>, "text": "<replacement>"},
+ *   ...
+ *   ]}
+ *
+ * The edits are sorted by offset and don't overlap. Only this layout is
+ * parsed, not JSON in general. Needs no libclang.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char *read_file(const char *name, size_t *len)
+{
+    FILE *f = fopen(name, "rb");
+    char *buf;
+    long size;
+
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = (char *) malloc(size + 1);
+    if (!buf || fread(buf, 1, size, f) != (size_t) size) {
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    buf[size] = 0;
+    fclose(f);
+    *len = size;
+
+    return buf;
+}
+
+static const char *skip_space(const char *p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+        p++;
+    return p;
+}
+
+/* Parses "key": <number> at *p, or returns -1 */
+static int parse_number(const char **p, const char *key, unsigned long *v)
+{
+    size_t len = strlen(key);
+    char *end;
+
+    *p = skip_space(*p);
+    if (**p != '"' || strncmp(*p + 1, key, len) || (*p)[len + 1] != '"')
+        return -1;
+    *p = skip_space(*p + len + 2);
+    if (**p != ':')
+        return -1;
+    *v = strtoul(*p + 1, &end, 10);
+    if (end == *p + 1)
+        return -1;
+    *p = skip_space(end);
+    if (**p == ',')
+        *p = skip_space(*p + 1);
+
+    return 0;
+}
+
+/*
+ * Decodes the JSON string at in, in place, into *text and *len. Returns
+ * the end of the string, or NULL. Only \u escapes below 0x100 are
+ * supported, which is all c99conv writes.
+ */
+static char *parse_string(char *in, char **text, size_t *len)
+{
+    char *out;
+
+    if (*in++ != '"')
+        return NULL;
+    out = *text = in;
+    for (; *in != '"'; in++) {
+        if (!*in)
+            return NULL;
+        if (*in != '\\') {
+            *out++ = *in;
+            continue;
+        }
+        switch (*++in) {
+        case 'n': *out++ = '\n'; break;
+        case 't': *out++ = '\t'; break;
+        case 'r': *out++ = '\r'; break;
+        case 'b': *out++ = '\b'; break;
+        case 'f': *out++ = '\f'; break;
+        case '"': case '\\': case '/': *out++ = *in; break;
+        case 'u': {
+            char hex[5] = { 0 }, *end;
+            unsigned long c;
+
+            strncpy(hex, in + 1, 4);
+            c = strtoul(hex, &end, 16);
+            if (end != hex + 4 || c > 0xff)
+                return NULL;
+            *out++ = (char) c;
+            in += 4;
+            break;
+        }
+        default:
+            return NULL;
+        }
+    }
+    *len = out - *text;
+
+    return in + 1;
+}
+
+/* Returns 1 for edits that don't fit the input, -1 if json is malformed */
+static int apply(const char *input, size_t len, char *json, FILE *out)
+{
+    unsigned long size, offset, length, pos = 0;
+    const char *p = strstr(json, "\"size\"");
+    char *text;
+    size_t text_len;
+
+    if (!p || parse_number(&p, "size", &size) || size != len) {
+        fprintf(stderr, "Edit list is for an input of a different size\n");
+        return 1;
+    }
+    p = strstr(p, "\"edits\"");
+    if (!p || *(p = skip_space(p + 7)) != ':' || *(p = skip_space(p + 1)) != '[')
+        return -1;
+    p = skip_space(p + 1);
+    while (*p == '{') {
+        p++;
+        if (parse_number(&p, "offset", &offset) ||
+            parse_number(&p, "length", &length) ||
+            strncmp(p, "\"text\"", 6) || *(p = skip_space(p + 6)) != ':')
+            return -1;
+        if (!(p = parse_string((char *) skip_space(p + 1), &text, &text_len)))
+            return -1;
+        p = skip_space(p);
+        if (*p++ != '}')
+            return -1;
+        p = skip_space(p);
+        if (*p == ',')
+            p = skip_space(p + 1);
+
+        if (offset < pos || offset + length > len) {
+            fprintf(stderr, "Edit at %lu is out of order or past the input\n",
+                    offset);
+            return 1;
+        }
+        fwrite(&input[pos], 1, offset - pos, out);
+        fwrite(text, 1, text_len, out);
+        pos = offset + length;
+    }
+    if (*p != ']')
+        return -1;
+    fwrite(&input[pos], 1, len - pos, out);
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    char *input, *json;
+    size_t len, json_len;
+    FILE *out;
+    int res;
+
+    if (argc != 4) {
+        fprintf(stderr, "%s <in> <edits> <out>\n", argv[0]);
+        return 1;
+    }
+    if (!(input = read_file(argv[1], &len))) {
+        fprintf(stderr, "Unable to open input file %s\n", argv[1]);
+        return 1;
+    }
+    if (!(json = read_file(argv[2], &json_len))) {
+        fprintf(stderr, "Unable to open edit list %s\n", argv[2]);
+        return 1;
+    }
+    if (!(out = fopen(argv[3], "wb"))) {
+        fprintf(stderr, "Unable to open output file %s\n", argv[3]);
+        return 1;
+    }
+    res = apply(input, len, json, out);
+    if (res < 0)
+        fprintf(stderr, "Malformed edit list %s\n", argv[2]);
+    if (fclose(out) || res) {
+        remove(argv[3]);
+        return 1;
+    }
+    free(input);
+    free(json);
+
+    return 0;
+}
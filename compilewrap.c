@@ -16,17 +16,34 @@
  * limitations under the License.
  */
 
+#ifndef _WIN32
+#define _GNU_SOURCE /* pipe2(), posix_spawn_file_actions_addchdir_np() */
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+
+#include <sys/stat.h>
 
 #ifdef _WIN32
 #include <windows.h>
+#include <process.h>
+#include <direct.h>
 #define getpid GetCurrentProcessId
 #else
 #include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <pthread.h>
+#include <time.h>
 #include <sys/wait.h>
-#include <wordexp.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #endif
 
 #ifdef _MSC_VER
@@ -41,158 +58,313 @@ static int DEBUG_LEVEL = 0;
 /* 0 == pass -E to the pre-processor, 1 == pass -EP */
 static int DEBUG_NO_LINE_DIRECTIVES = 0;
 
+#ifdef _WIN32
+/* Quotes argv into a command line, the way the C runtime splits it again. */
 static char* create_cmdline(char **argv)
 {
     int i;
-    int len = 0, pos = 0;
+    size_t len = 0, pos = 0;
     char *out;
 
     for (i = 0; argv[i]; i++)
-        len += strlen(argv[i]);
+        len += 2 * strlen(argv[i]) + 3;
 
-    out = malloc(len + 4 * i + 10);
+    out = malloc(len + 1);
 
     for (i = 0; argv[i]; i++) {
-        int contains_space = 0, j;
-
-        for (j = 0; argv[i][j] && !contains_space; j++)
-            if (argv[i][j] == ' ')
-                contains_space = 1;
+        const char *p = argv[i];
 
-        if (contains_space)
-            out[pos++] = '"';
-
-        strcpy(&out[pos], argv[i]);
-        pos += strlen(argv[i]);
+        if (i)
+            out[pos++] = ' ';
+        if (*p && !strpbrk(p, " \t\"")) {
+            strcpy(&out[pos], p);
+            pos += strlen(p);
+            continue;
+        }
 
-        if (contains_space)
-            out[pos++] = '"';
+        /* backslashes are literal, unless they precede a quote */
+        out[pos++] = '"';
+        for (;; p++) {
+            size_t slashes = 0;
 
-        if (argv[i + 1])
-            out[pos++] = ' ';
+            while (*p == '\\') {
+                slashes++;
+                p++;
+            }
+            if (!*p || *p == '"')
+                slashes = 2 * slashes + (*p == '"');
+            memset(&out[pos], '\\', slashes);
+            pos += slashes;
+            if (!*p)
+                break;
+            out[pos++] = *p;
+        }
+        out[pos++] = '"';
     }
 
     out[pos] = '\0';
 
     return out;
 }
+#endif
+
+/*
+ * Process spawning. Commands run directly from their argv, without a
+ * shell, in dir (the current directory if NULL). Their stdout (stderr
+ * with out_0_err_1 1, both with 2) may be captured into memory, or go
+ * straight into a file, while the other stream passes through. Any number of children may
+ * run at a time, from several threads: the capture pipes are kept out of
+ * the other children.
+ */
+typedef struct {
+#ifdef _WIN32
+    HANDLE process;
+    HANDLE pipe;
+#else
+    pid_t pid;
+    int pipe;
+#endif
+} Child;
 
-/* On Windows, system() has very frugal length limits */
 #ifdef _WIN32
-static int exec_argv_out(char **argv, int out_0_err_1, const char *out)
+/*
+ * CreateProcess has every inheritable handle inherited, so a child's
+ * handles are only made inheritable under this lock, just for its
+ * CreateProcess.
+ */
+static CRITICAL_SECTION spawn_lock;
+
+static int spawn_start(Child *child, char **argv, int out_0_err_1,
+                       int capture, const char *out_file, const char *dir)
 {
     STARTUPINFO si = { 0 };
     PROCESS_INFORMATION pi = { 0 };
-    DWORD exit_code;
+    HANDLE handle = NULL;
     char *cmdline = create_cmdline(argv);
-    FILE *fp = NULL;
-    HANDLE pipe_read, pipe_write = NULL;
-    BOOL inherit = FALSE;
-
-    if (out) {
-        char temp[2048];
-        /* When debugging this code I wasted a lot of time on this due to file locking.
-           system del seems to be the most reliable way to work around that. Also the
-           error message below is less cryptic than the one from perror(). */
-        if(_access(out, 0) == 0) {
-            sprintf(temp, "del \"%s\"", out);
-            system(temp);
-        }
-        SECURITY_ATTRIBUTES sa = { 0 };
-        fp = fopen(out, "wb");
-        if (!fp) {
-            printf("ERROR :: c99wrap failed to open out %s\n", out);
-            perror(out);
-            return 1;
-        }
-        sa.nLength = sizeof(sa);
-        sa.bInheritHandle = TRUE;
-        CreatePipe(&pipe_read, &pipe_write, &sa, 0);
-        si.cb = sizeof(si);
-        si.dwFlags = STARTF_USESTDHANDLES;
-        if (out_0_err_1 == 0) {
-            si.hStdOutput = pipe_write;
-            si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+    BOOL ok;
+
+    fflush(stdout);
+    child->pipe = NULL;
+    si.cb = sizeof(si);
+    if (capture) {
+        if (!CreatePipe(&child->pipe, &handle, NULL, 0)) {
+            free(cmdline);
+            return -1;
         }
-        else {
-            si.hStdOutput = GetStdHandle(STD_OUTPUT_HANDLE);
-            si.hStdError = pipe_write;
+    } else if (out_file) {
+        /* When debugging this code I wasted a lot of time on this due to
+           file locking; deleting the file first seems to be the most
+           reliable way to work around that. Also the error message below
+           is less cryptic than the one from perror(). */
+        DeleteFile(out_file);
+        handle = CreateFile(out_file, GENERIC_WRITE, FILE_SHARE_READ, NULL,
+                            CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (handle == INVALID_HANDLE_VALUE) {
+            printf("ERROR :: c99wrap failed to open out %s\n", out_file);
+            free(cmdline);
+            return -1;
         }
-        inherit = TRUE;
     }
-    if (CreateProcess(NULL, cmdline, NULL, NULL, inherit, 0, NULL, NULL, &si, &pi)) {
-        free(cmdline);
-        if (out) {
-            char buf[8192];
-            DWORD n;
-            CloseHandle(pipe_write);
-            while (ReadFile(pipe_read, buf, sizeof(buf), &n, NULL))
-                fwrite(buf, 1, n, fp);
-            CloseHandle(pipe_read);
-            fclose(fp);
-        }
+    if (handle) {
+        si.dwFlags = STARTF_USESTDHANDLES;
+        si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+        si.hStdOutput = out_0_err_1 != 1 ? handle : GetStdHandle(STD_OUTPUT_HANDLE);
+        si.hStdError = out_0_err_1 ? handle : GetStdHandle(STD_ERROR_HANDLE);
+    }
+
+    EnterCriticalSection(&spawn_lock);
+    if (handle)
+        SetHandleInformation(handle, HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT);
+    ok = CreateProcess(NULL, cmdline, NULL, NULL, handle != NULL, 0, NULL,
+                       dir, &si, &pi);
+    if (handle)
+        CloseHandle(handle);
+    LeaveCriticalSection(&spawn_lock);
+    free(cmdline);
+    if (!ok) {
+        fprintf(stderr, "Unable to run %s\n", argv[0]);
+        if (child->pipe)
+            CloseHandle(child->pipe);
+        return -1;
+    }
+    CloseHandle(pi.hThread);
+    child->process = pi.hProcess;
 
-        WaitForSingleObject(pi.hProcess, INFINITE);
+    return 0;
+}
 
-        if (!GetExitCodeProcess(pi.hProcess, &exit_code))
-            exit_code = -1;
+static int spawn_read(Child *child, char *buf, size_t size)
+{
+    DWORD n;
 
-        CloseHandle(pi.hProcess);
-        CloseHandle(pi.hThread);
+    if (!ReadFile(child->pipe, buf, (DWORD) size, &n, NULL))
+        return 0;
+    return (int) n;
+}
 
-        return exit_code;
-    } else {
-        if (out) {
-            fclose(fp);
-            CloseHandle(pipe_read);
-            CloseHandle(pipe_write);
+static int spawn_wait(Child *child)
+{
+    DWORD exit_code;
+
+    if (child->pipe)
+        CloseHandle(child->pipe);
+    WaitForSingleObject(child->process, INFINITE);
+    if (!GetExitCodeProcess(child->process, &exit_code))
+        exit_code = -1;
+    CloseHandle(child->process);
+
+    return exit_code;
+}
+#else
+extern char **environ;
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+#define HAVE_SPAWN_CHDIR
+#endif
+
+static int spawn_start(Child *child, char **argv, int out_0_err_1,
+                       int capture, const char *out_file, const char *dir)
+{
+    posix_spawn_file_actions_t actions;
+    int fds[2] = { -1, -1 };
+    int target = out_0_err_1 ? STDERR_FILENO : STDOUT_FILENO;
+    int ret;
+
+    /* our own output comes first */
+    fflush(stdout);
+    child->pipe = -1;
+    if (capture) {
+#ifdef __linux__
+        if (pipe2(fds, O_CLOEXEC)) {
+#else
+        if (pipe(fds) || fcntl(fds[0], F_SETFD, FD_CLOEXEC) ||
+            fcntl(fds[1], F_SETFD, FD_CLOEXEC)) {
+#endif
+            perror("pipe");
+            return -1;
+        }
+    }
+#ifndef HAVE_SPAWN_CHDIR
+    if (dir) {
+        /* no posix_spawn_file_actions_addchdir_np() */
+        if (!(child->pid = fork())) {
+            int fd = fds[1];
+
+            if (out_file && (fd = open(out_file, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
+                perror(out_file);
+                _exit(1);
+            }
+            if (fd >= 0)
+                dup2(fd, target);
+            if (fd >= 0 && out_0_err_1 == 2)
+                dup2(fd, STDOUT_FILENO);
+            if (chdir(dir)) {
+                perror(dir);
+                _exit(1);
+            }
+            execvp(argv[0], argv);
+            perror(argv[0]);
+            _exit(1);
         }
-        free(cmdline);
+        ret = child->pid < 0 ? errno : 0;
+    } else
+#endif
+    {
+        posix_spawn_file_actions_init(&actions);
+        if (capture)
+            posix_spawn_file_actions_adddup2(&actions, fds[1], target);
+        else if (out_file)
+            posix_spawn_file_actions_addopen(&actions, target, out_file,
+                                             O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        if ((capture || out_file) && out_0_err_1 == 2)
+            posix_spawn_file_actions_adddup2(&actions, target, STDOUT_FILENO);
+#ifdef HAVE_SPAWN_CHDIR
+        if (dir)
+            posix_spawn_file_actions_addchdir_np(&actions, dir);
+#endif
+        ret = posix_spawnp(&child->pid, argv[0], &actions, NULL, argv, environ);
+        posix_spawn_file_actions_destroy(&actions);
+    }
+    if (capture)
+        close(fds[1]);
+    if (ret) {
+        fprintf(stderr, "Unable to run %s: %s\n", argv[0], strerror(ret));
+        if (capture)
+            close(fds[0]);
         return -1;
     }
+    child->pipe = fds[0];
+
+    return 0;
 }
-#else
-static int exec_argv_out(char **argv, int out_0_err_1, const char *out)
+
+static int spawn_read(Child *child, char *buf, size_t size)
 {
-    int fds[2];
-    pid_t pid;
-    int ret = 0;
-    FILE *fp;
-    if (!out) {
-        char *cmdline = create_cmdline(argv);
-        ret = system(cmdline);
-        free(cmdline);
-        return ret;
-    }
-    fp = fopen(out, "wb");
-    if (!fp) {
-        perror(out);
+    ssize_t n;
+
+    do {
+        n = read(child->pipe, buf, size);
+    } while (n < 0 && errno == EINTR);
+
+    return n > 0 ? (int) n : 0;
+}
+
+static int spawn_wait(Child *child)
+{
+    int status;
+
+    if (child->pipe >= 0)
+        close(child->pipe);
+    while (waitpid(child->pid, &status, 0) < 0)
+        if (errno != EINTR)
+            return 1;
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+#endif
+
+/*
+ * Runs argv, with its stdout (or stderr) written to out if given. dir is
+ * the working directory for the command, NULL for the current one.
+ */
+static int exec_argv_out(char **argv, int out_0_err_1, const char *out,
+                         const char *dir)
+{
+    Child child;
+
+    if (spawn_start(&child, argv, out_0_err_1, 0, out, dir))
         return 1;
-    }
 
-    pipe(fds);
-    if (!(pid = fork())) {
-        close(fds[0]);
-        dup2(fds[1], STDOUT_FILENO);
-        if (execvp(argv[0], argv)) {
-            perror("execvp");
-            exit(1);
+    return spawn_wait(&child);
+}
+
+/*
+ * Runs argv like exec_argv_out(), with the output captured into *buf
+ * (NUL-terminated, *len bytes without the NUL).
+ */
+static int exec_argv_capture(char **argv, int out_0_err_1, char **buf,
+                             size_t *len, const char *dir)
+{
+    Child child;
+    size_t size = 65536;
+    int n;
+
+    *len = 0;
+    *buf = NULL;
+    if (spawn_start(&child, argv, out_0_err_1, 1, NULL, dir))
+        return 1;
+    *buf = malloc(size);
+    while ((n = spawn_read(&child, *buf + *len, size - *len - 1)) > 0) {
+        *len += n;
+        if (size - *len < 4096) {
+            size *= 2;
+            *buf = realloc(*buf, size);
         }
     }
-    close(fds[1]);
-    while (1) {
-        char buf[8192];
-        int n = read(fds[0], buf, sizeof(buf));
-        if (n <= 0)
-            break;
-        fwrite(buf, 1, n, fp);
-    }
-    close(fds[0]);
-    fclose(fp);
-    waitpid(pid, &ret, 0);
-    return WEXITSTATUS(ret);
+    (*buf)[*len] = '\0';
+
+    return spawn_wait(&child);
 }
-#endif
 
 
 /* Permits flags beginning with either - or / */
@@ -219,118 +391,105 @@ int flagstrncmp ( const char * str1, const char * str2, size_t num )
 }
 
 
-char **split_commandline(char *cmdline, int *argc)
+/*
+ * Splits cmdline into arguments, by the rules of the Microsoft C runtime
+ * (msvc), or else those of GCC's @file: white space separates them (line
+ * breaks too, for response files), '...' and "..." quote, and a backslash
+ * escapes the next character. No shell is involved, so nothing is
+ * expanded. Counts the arguments only if argv is NULL.
+ */
+static int split_args(const char *p, int msvc, char **argv, char *out)
 {
-    int i;
-    char **argv = NULL;
-
-    if (!cmdline) {
-        return NULL;
-    }
-
-    /* Get rid of anything after the first newline (0d 0a) */
-    if (strchr(cmdline, 0x0d)) {
-        *strchr(cmdline, 0x0d) = '\0';
-    }
-    if (strchr(cmdline, 0x0a)) {
-        *strchr(cmdline, 0x0a) = '\0';
-    }
-
- #ifndef _WIN32
-    {
-        wordexp_t p;
-
-        // Note! This expands shell variables.
-        if (wordexp(cmdline, &p, 0))
-        {
-            return NULL;
-        }
+#define IS_SPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\n' || \
+                     (c) == '\f' || (c) == '\v')
+#define PUT(c) do { if (out) *out++ = (c); } while (0)
+    int argc = 0;
 
-        *argc = p.we_wordc;
-
-        if (!(argv = calloc(*argc, sizeof(char *))))
-        {
-            goto fail;
-        }
+    for (;;) {
+        int quote = 0, escape = 0;
 
-        for (i = 0; i < p.we_wordc; i++)
-        {
-            if (!(argv[i] = strdup(p.we_wordv[i])))
-            {
-                goto fail;
+        while (IS_SPACE(*p))
+            p++;
+        if (!*p)
+            break;
+        if (argv)
+            argv[argc] = out;
+        argc++;
+
+        for (; *p && (quote || escape || !IS_SPACE(*p)); p++) {
+            if (msvc && *p == '\\') {
+                /* backslashes are literal, unless they precede a quote */
+                size_t i, n = 0;
+
+                while (p[n] == '\\')
+                    n++;
+                for (i = 0; i < (p[n] == '"' ? n / 2 : n); i++)
+                    PUT('\\');
+                if (p[n] == '"' && (n & 1)) {
+                    PUT('"');
+                    p += n;
+                } else {
+                    p += n - 1;
+                }
+            } else if (msvc && *p == '"') {
+                /* "" within quotes is a literal quote */
+                if (quote && p[1] == '"') {
+                    PUT('"');
+                    p++;
+                } else {
+                    quote = !quote;
+                }
+            } else if (msvc) {
+                PUT(*p);
+            } else if (escape) {
+                escape = 0;
+                PUT(*p);
+            } else if (*p == '\\') {
+                escape = 1;
+            } else if (quote) {
+                if (*p == quote)
+                    quote = 0;
+                else
+                    PUT(*p);
+            } else if (*p == '\'' || *p == '"') {
+                quote = *p;
+            } else {
+                PUT(*p);
             }
         }
-
-        wordfree(&p);
-
-        return argv;
-    fail:
-        wordfree(&p);
+        PUT('\0');
     }
-#else
-    {
-        wchar_t **wargs = NULL;
-        size_t needed = 0;
-        wchar_t *cmdlinew = NULL;
-        size_t len = strlen(cmdline) + 1;
-
-        if (!(cmdlinew = calloc(len, sizeof(wchar_t))))
-            goto fail;
-
-        if (!MultiByteToWideChar(CP_ACP, 0, cmdline, -1, cmdlinew, len))
-            goto fail;
 
-        if (!(wargs = CommandLineToArgvW(cmdlinew, argc)))
-            goto fail;
-
-        if (!(argv = calloc(*argc, sizeof(char *))))
-            goto fail;
-
-        // Convert from wchar_t * to ANSI char *
-        for (i = 0; i < *argc; i++)
-        {
-            // Get the size needed for the target buffer.
-            // CP_ACP = Ansi Codepage.
-            needed = WideCharToMultiByte(CP_ACP, 0, wargs[i], -1,
-                                        NULL, 0, NULL, NULL);
-
-            if (!(argv[i] = malloc(needed)))
-                goto fail;
-
-            // Do the conversion.
-            needed = WideCharToMultiByte(CP_ACP, 0, wargs[i], -1,
-                                        argv[i], needed, NULL, NULL);
-        }
-
-        if (wargs) LocalFree(wargs);
-        if (cmdlinew) free(cmdlinew);
-        return argv;
+    return argc;
+#undef PUT
+#undef IS_SPACE
+}
 
-    fail:
-        if (wargs) LocalFree(wargs);
-        if (cmdlinew) free(cmdlinew);
-    }
-    #endif // WIN32
+/*
+ * Returns the arguments in cmdline, see split_args(), as a NULL-terminated
+ * array allocated together with the strings, for a single free().
+ */
+char **split_commandline(const char *cmdline, int msvc, int *argc)
+{
+    char **argv;
 
-    if (argv)
-    {
-        for (i = 0; i < *argc; i++)
-        {
-            if (argv[i])
-            {
-                free(argv[i]);
-            }
-        }
+    if (!cmdline)
+        return NULL;
 
-        free(argv);
-    }
+    /* the arguments are no longer than the command line */
+    *argc = split_args(cmdline, msvc, NULL, NULL);
+    argv = malloc((*argc + 1) * sizeof(*argv) + strlen(cmdline) + 1);
+    if (!argv)
+        return NULL;
+    split_args(cmdline, msvc, argv, (char *) (argv + *argc + 1));
+    argv[*argc] = NULL;
 
-    return NULL;
+    return argv;
 }
 
 
-/* Allocates and returns a buffer containing the contents of filename with a NULL terminator. */
-char * read_file(const char * filename) {
+/* Like read_file(), also returning the length of the file. */
+static char * read_file_len(const char * filename, size_t * size) {
     char * buf = NULL;
     long len;
     FILE * f = fopen (filename, "rb");
@@ -341,14 +500,22 @@ char * read_file(const char * filename) {
         fseek (f, 0, SEEK_SET);
         buf = malloc (len + 1);
         if (buf != NULL) {
-            fread (buf, 1, len, f);
+            len = fread (buf, 1, len, f);
             buf[len] = '\0';
+            *size = len;
         }
         fclose (f);
     }
     return buf;
 }
 
+/* Allocates and returns a buffer containing the contents of filename with a NULL terminator. */
+char * read_file(const char * filename) {
+    size_t len;
+
+    return read_file_len(filename, &len);
+}
+
 
 void write_file(const char * buf, size_t len, const char * filename)
 {
@@ -360,6 +527,30 @@ void write_file(const char * buf, size_t len, const char * filename)
     fclose(f);
 }
 
+/*
+ * Like write_file(), but leaves filename (and its mtime) alone if it
+ * already holds buf, and otherwise replaces it with a rename.
+ */
+static void update_file(const char * buf, size_t len, const char * filename)
+{
+    char tmp[2048 + 32];
+    size_t old_len = 0;
+    char *old = read_file_len(filename, &old_len);
+    int same = old && old_len == len && !memcmp(old, buf, len);
+
+    free(old);
+    if (same)
+        return;
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", filename, (int) getpid());
+    write_file(buf, len, tmp);
+#ifdef _WIN32
+    if (!MoveFileExA(tmp, filename, MOVEFILE_REPLACE_EXISTING))
+#else
+    if (rename(tmp, filename))
+#endif
+        perror(filename);
+}
+
 
 void print_argv(char * name, char ** argv, int argc, int force_print)
 {
@@ -395,121 +586,1020 @@ size_t remove_string(char * input, char * to_remove, size_t * initialsz)
     return finalsz;
 }
 
-int main(int argc, char *argv[])
+/*
+ * Gets the target bitness and the major version of the compiler from the
+ * banner it prints when run without arguments, e.g. "Microsoft (R) C/C++
+ * Optimizing Compiler Version 18.00.40629 for x64". Starting cl for every
+ * compile is slow, so the result is cached in C99_TO_C89_WRAP_CACHE_DIR
+ * (or the temp directory), keyed by the compiler name and the environment
+ * variables that select it. Delete the c99wrap_*.probe files to re-probe.
+ */
+static void probe_compiler(char **argv, int *bits_32, int *major)
 {
-    int i = 1;
-    int cpp_argc, cc_argc, pass_argc;
-    int exit_code;
-    int input_source = 0, input_obj = 0;
-    int msvc = 0, icl = 0, keep = 0, noconv = 0, flag_compile = 0;
-    char *ptr;
-    char temp_file_1[2048], temp_file_2[2048], temp_file_3[2046],
-         fo_buffer[2048], fi_buffer[2048];
-    char **cpp_argv, **cc_argv, **pass_argv, **bitness_argv;
-    char *conv_argv[6], *conv_tool;
-    const char *source_file = NULL;
-    const char *outname = NULL;
-    char *response_file = NULL;
-    const char *envvar = NULL;
-    char convert_options[20] = "";
-    char convert_bitness[4] = "-64";
-
-    conv_tool = malloc(strlen(argv[0]) + strlen(CONVERTER) + 1);
-    strcpy(conv_tool, argv[0]);
+    static const char *env_vars[] = { "PATH", "INCLUDE", "LIB" };
+    const char *dir = getenv("C99_TO_C89_WRAP_CACHE_DIR");
+    char cache_file[2048] = "";
+    char *banner, *version;
+    size_t len;
+    FILE *f;
+    int i;
 
-    envvar = getenv("C99_TO_C89_WRAP_DEBUG_LEVEL");
-    if (envvar != NULL) {
-        DEBUG_LEVEL = strtoll(envvar, NULL, 10);
-        envvar = NULL;
-    }
-    envvar = getenv("C99_TO_C89_WRAP_SAVE_TEMPS");
-    if (envvar != NULL) {
-        keep = strtoll(envvar, NULL, 10);
-        envvar = NULL;
+    if (!dir || !dir[0])
+        dir = getenv("TEMP");
+    if (!dir || !dir[0])
+        dir = getenv("TMPDIR");
+    if (dir && dir[0]) {
+        unsigned long hash = 5381;
+        const char *p;
+
+        for (p = argv[0]; *p; p++)
+            hash = hash * 33 + (unsigned char) *p;
+        for (i = 0; i < (int) (sizeof(env_vars) / sizeof(env_vars[0])); i++) {
+            const char *val = getenv(env_vars[i]);
+            hash = hash * 33 + '\n';
+            for (p = val ? val : ""; *p; p++)
+                hash = hash * 33 + (unsigned char) *p;
+        }
+        snprintf(cache_file, sizeof(cache_file), "%s/c99wrap_%08lx.probe",
+                 dir, hash & 0xffffffffUL);
+        f = fopen(cache_file, "r");
+        if (f) {
+            int ok = fscanf(f, "%d %d", bits_32, major) == 2;
+            fclose(f);
+            if (ok)
+                return;
+        }
     }
-    envvar = getenv("C99_TO_C89_WRAP_NO_LINE_DIRECTIVES");
-    if (envvar != NULL) {
-        DEBUG_NO_LINE_DIRECTIVES = strtoll(envvar, NULL, 10);
-        envvar = NULL;
+
+    *bits_32 = 0;
+    *major = 0;
+    /* cl prints it to stderr, but look at both */
+    exec_argv_capture(argv, 2, &banner, &len, NULL);
+    if (!banner)
+        return;
+    if (strstr(banner, "80x86"))
+        *bits_32 = 1;
+    /* a localized banner leaves major at 0, which selects all rewrites */
+    version = strstr(banner, "Version ");
+    if (version)
+        *major = (int) strtol(version + 8, NULL, 10);
+    free(banner);
+
+    /* only cache a successful probe */
+    if (cache_file[0] && *major && (f = fopen(cache_file, "w"))) {
+        fprintf(f, "%d %d\n", *bits_32, *major);
+        fclose(f);
     }
+}
 
-    ptr = strrchr(conv_tool, '\\');
-    if (!ptr)
-        ptr = strrchr(conv_tool, '/');
+#ifdef _WIN32
+typedef HANDLE Thread;
+typedef CRITICAL_SECTION Mutex;
+#define mutex_init(m)       InitializeCriticalSection(m)
+#define mutex_destroy(m)    DeleteCriticalSection(m)
+#define mutex_lock(m)       EnterCriticalSection(m)
+#define mutex_unlock(m)     LeaveCriticalSection(m)
+#else
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+#define mutex_init(m)       pthread_mutex_init(m, NULL)
+#define mutex_destroy(m)    pthread_mutex_destroy(m)
+#define mutex_lock(m)       pthread_mutex_lock(m)
+#define mutex_unlock(m)     pthread_mutex_unlock(m)
+#endif
 
-    if (!ptr)
-        conv_tool[0] = '\0';
-    else
-        ptr[1] = '\0';
-    strcat(conv_tool, CONVERTER);
+static unsigned cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (unsigned) n : 1;
+#endif
+}
 
-    for (; i < argc; i++) {
-        if (!strcmp(argv[i], "-keep")) {
-            keep = 1;
-        } else if (!strcmp(argv[i], "-noconv")) {
-            noconv = 1;
-        } else
-            break;
-    }
+typedef struct {
+    const char *conv_tool;
+    int keep, noconv;
+    int update;             /* -keep, but only rewrite files that changed */
+    int compact;            /* c99conv -compact */
+    const char *profile;    /* NULL: chosen from the compiler version */
+    const char *dir;        /* working directory of the command, or NULL */
+    const char *tag;        /* keeps pid-based temp names of jobs apart */
+    int probed;             /* bits_32 and cl_major are already known */
+    int bits_32, cl_major;  /* see probe_compiler() */
+    const char *outname;    /* of the command, for the trace */
+    /* results */
+    size_t preprocessed_size;
+    double t_preprocess, t_convert, t_compile;
+} WrapContext;
+
+static double get_time(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double) count.QuadPart / freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+#endif
+}
 
-    if (keep && noconv) {
-        fprintf(stderr, "Using -keep with -noconv doesn't make any sense!\n "
-                        "You cannot keep intermediate files that doesn't exist.\n");
-        return 1;
-    }
+/*
+ * C99_TO_C89_WRAP_TRACE=<file>: each stage is appended to file as a Chrome
+ * trace event (chrome://tracing, Perfetto), so that all wrappers of a
+ * parallel build can share one timeline. The file is a JSON array that is
+ * never closed, which both viewers accept. Whoever creates the file writes
+ * the opening bracket, by moving a file holding just that into place; each
+ * event is then appended with a single write. get_time() is system-wide,
+ * so the timestamps of all processes line up.
+ */
+static struct {
+    int active;
+#ifdef _WIN32
+    HANDLE file;
+#else
+    int fd;
+#endif
+} trace;
 
-    if (i < argc && !strncmp(argv[i], "cl", 2) && (argv[i][2] == '.' || argv[i][2] == '\0')) {
-        msvc = 1;
-        strcpy(convert_options, "-ms");
-    } else if (i < argc && !strncmp(argv[i], "icl", 3) && (argv[i][3] == '.' || argv[i][3] == '\0')) {
-        msvc = 1; /* for command line compatibility */
-        icl = 1;
+static void trace_init(void)
+{
+    const char *path = getenv("C99_TO_C89_WRAP_TRACE");
+    char tmp[2048];
+    FILE *f;
+
+    if (!path || !path[0])
+        return;
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int) getpid());
+    f = fopen(tmp, "wb");
+    if (f) {
+        fputs("[\n", f);
+        fclose(f);
+#ifdef _WIN32
+        if (!MoveFileExA(tmp, path, 0))
+            DeleteFileA(tmp);
+#else
+        link(tmp, path); /* unlike rename(), fails if path exists */
+        unlink(tmp);
+#endif
     }
+#ifdef _WIN32
+    /* without FILE_WRITE_DATA, all writes go to the end of the file */
+    trace.file = CreateFileA(path, FILE_APPEND_DATA, FILE_SHARE_READ |
+                             FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+                             OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    trace.active = trace.file != INVALID_HANDLE_VALUE;
+#else
+    trace.fd = open(path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+    trace.active = trace.fd >= 0;
+#endif
+    if (!trace.active)
+        fprintf(stderr, "Unable to open trace file %s\n", path);
+}
 
-    /* Are we using a response file? If so reform argv and argc from it. */
-    if (argv[argc-1][0] == '@') {
-        response_file = read_file(&(argv[argc-1][1]));
-        if (response_file) {
-            if (DEBUG_LEVEL > 1) {
-                printf("Response file contents:\n%s\n", response_file);
-            }
-            char ** argv_temp = split_commandline(response_file, &argc);
-            char *cl_or_icl = argv[i];
-            argv = malloc((argc+1) * sizeof(char*));
-            argv[0] = cl_or_icl;
-            memcpy(&argv[1], argv_temp, argc * sizeof(char*));
-            argc++;
-            i = 0;
-            /* Print the commandline as this is one of the most difficult aspects of dealing
-            with CMake on Windows. If it uses a response file (often it will) you are forced
-            to use something like procmon to see the flags passed. */
-            if (icl == 0)
-                printf("c99wrap cl ");
-            else
-                printf("c99wrap icl ");
-            print_argv("argv", argv + 1, argc - 1, 1);
+/* The time to pass to trace_event(), 0 if not tracing. */
+static double trace_time(void)
+{
+    return trace.active ? get_time() : 0.0;
+}
 
+static unsigned long trace_tid(void)
+{
+#ifdef _WIN32
+    return GetCurrentThreadId();
+#elif defined(__linux__)
+    return (unsigned long) syscall(SYS_gettid);
+#else
+    return (unsigned long) (uintptr_t) pthread_self();
+#endif
+}
+
+/* Copies str into buf as the contents of a JSON string. */
+static void trace_escape(char *buf, size_t size, const char *str)
+{
+    size_t n = 0;
+
+    for (; str && *str && n + 7 < size; str++) {
+        if (*str == '"' || *str == '\\') {
+            buf[n++] = '\\';
+            buf[n++] = *str;
+        } else if ((unsigned char) *str < 0x20) {
+            n += sprintf(buf + n, "\\u%04x", (unsigned char) *str);
+        } else {
+            buf[n++] = *str;
         }
     }
+    buf[n] = 0;
+}
 
-    sprintf(temp_file_1, "preprocessed_%d.c", getpid());
-    sprintf(temp_file_2, "converted_%d.c", getpid());
-    sprintf(temp_file_3, "bitness_%d.c", getpid());
+/*
+ * Appends a complete event for the stage name, which ran from start to
+ * end. file is the stage's own input or output file, outname that of the
+ * whole command.
+ */
+static void trace_event(const char *name, double start, double end,
+                        const char *outname, const char *file)
+{
+    char buf[8192], output[2048], input[2048];
+    int len;
 
-    cpp_argv     = malloc((argc + 2) * sizeof(*cpp_argv));
-    cc_argv      = malloc((argc + 3) * sizeof(*cc_argv));
-    pass_argv    = malloc((argc + 3) * sizeof(*pass_argv));
-    bitness_argv = malloc(2 * sizeof(*bitness_argv));
+    if (!trace.active)
+        return;
+    trace_escape(output, sizeof(output), outname);
+    trace_escape(input, sizeof(input), file);
+    len = snprintf(buf, sizeof(buf),
+                   "{\"name\": \"%s\", \"cat\": \"c99wrap\", \"ph\": \"X\", "
+                   "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %lu, "
+                   "\"args\": {\"output\": \"%s\", \"file\": \"%s\"}},\n",
+                   name, start * 1e6, (end - start) * 1e6, (int) getpid(),
+                   trace_tid(), output, input);
+    if (len < 0 || len >= (int) sizeof(buf))
+        return;
+#ifdef _WIN32
+    {
+        DWORD written;
+        WriteFile(trace.file, buf, len, &written, NULL);
+    }
+#else
+    if (write(trace.fd, buf, len) != len)
+        trace.active = 0;
+#endif
+}
+
+static int is_absolute_path(const char *path)
+{
+    return path[0] == '/' || path[0] == '\\' ||
+           (path[0] && path[1] == ':');
+}
+
+/*
+ * Names a temp file. The commands run in ctx->dir, which need not be our
+ * working directory, so relative names are resolved against it. Returns 1
+ * if the name doesn't fit in buf.
+ */
+static int temp_name(char *buf, size_t size, const WrapContext *ctx,
+                     const char *base, const char *suffix)
+{
+    int len;
+
+    if (ctx->dir && !is_absolute_path(base))
+        len = snprintf(buf, size, "%s/%s%s", ctx->dir, base, suffix);
+    else
+        len = snprintf(buf, size, "%s%s", base, suffix);
+    if (len < 0 || (size_t) len >= size) {
+        fprintf(stderr, "Temp file name too long for %s\n", base);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+ * Response files may be UTF-16, as written by some tools (with a BOM).
+ * Returns a NUL-terminated copy of the len bytes of buf, converted to the
+ * ANSI code page on Windows and to UTF-8 elsewhere.
+ */
+static char *decode_text(const char *buf, size_t len)
+{
+    const unsigned char *in = (const unsigned char *) buf;
+    int big_endian;
+    char *out;
+
+    if (len < 2 || !((in[0] == 0xff && in[1] == 0xfe) ||
+                     (in[0] == 0xfe && in[1] == 0xff))) {
+        /* UTF-8 or the code page, maybe with a UTF-8 BOM */
+        if (len >= 3 && in[0] == 0xef && in[1] == 0xbb && in[2] == 0xbf) {
+            in += 3;
+            len -= 3;
+        }
+        out = malloc(len + 1);
+        if (out) {
+            memcpy(out, in, len);
+            out[len] = '\0';
+        }
+        return out;
+    }
+
+    big_endian = in[0] == 0xfe;
+    in += 2;
+    len = (len - 2) / 2;
+#define UNIT(i) (big_endian ? in[2 * (i)] << 8 | in[2 * (i) + 1] : \
+                              in[2 * (i) + 1] << 8 | in[2 * (i)])
+#ifdef _WIN32
+    {
+        wchar_t *wide = malloc((len + 1) * sizeof(*wide));
+        size_t i;
+        int needed;
+
+        if (!wide)
+            return NULL;
+        for (i = 0; i < len; i++)
+            wide[i] = UNIT(i);
+        wide[len] = 0;
+        needed = WideCharToMultiByte(CP_ACP, 0, wide, -1, NULL, 0, NULL, NULL);
+        out = malloc(needed > 0 ? needed : 1);
+        if (out && needed > 0)
+            WideCharToMultiByte(CP_ACP, 0, wide, -1, out, needed, NULL, NULL);
+        else if (out)
+            out[0] = '\0';
+        free(wide);
+    }
+#else
+    {
+        size_t i, pos = 0;
+
+        /* at most 3 bytes per UTF-16 unit */
+        out = malloc(3 * len + 1);
+        if (!out)
+            return NULL;
+        for (i = 0; i < len; i++) {
+            unsigned long c = UNIT(i);
+
+            if (c >= 0xd800 && c < 0xdc00 && i + 1 < len &&
+                UNIT(i + 1) >= 0xdc00 && UNIT(i + 1) < 0xe000) {
+                c = 0x10000 + ((c - 0xd800) << 10) + (UNIT(i + 1) - 0xdc00);
+                i++;
+            }
+            if (c < 0x80) {
+                out[pos++] = c;
+            } else if (c < 0x800) {
+                out[pos++] = 0xc0 | c >> 6;
+                out[pos++] = 0x80 | (c & 0x3f);
+            } else if (c < 0x10000) {
+                out[pos++] = 0xe0 | c >> 12;
+                out[pos++] = 0x80 | (c >> 6 & 0x3f);
+                out[pos++] = 0x80 | (c & 0x3f);
+            } else {
+                out[pos++] = 0xf0 | c >> 18;
+                out[pos++] = 0x80 | (c >> 12 & 0x3f);
+                out[pos++] = 0x80 | (c >> 6 & 0x3f);
+                out[pos++] = 0x80 | (c & 0x3f);
+            }
+        }
+        out[pos] = '\0';
+    }
+#endif
+#undef UNIT
+
+    return out;
+}
+
+/* Response files may refer to others; stop at some depth, for cycles. */
+#define MAX_RESPONSE_DEPTH 16
+
+/*
+ * Replaces the @file arguments of argv with the arguments in the files,
+ * recursively. Relative names are looked up in dir, if given; an @file
+ * that can't be read stays as it is, like with GCC. Returns argv itself if
+ * there was nothing to replace, or else a new array (for a single free(),
+ * like split_commandline()).
+ */
+static char **expand_response_files(char **argv, int *argc, int msvc,
+                                    const char *dir, int depth)
+{
+    char ***files;
+    int *counts;
+    int i, j, n = 0, expanded = 0;
+    size_t size = 0;
+    char **out = argv, *str;
+
+    if (depth >= MAX_RESPONSE_DEPTH)
+        return argv;
+    files = calloc(*argc, sizeof(*files));
+    counts = calloc(*argc, sizeof(*counts));
+    for (i = 0; i < *argc; i++) {
+        if (argv[i][0] == '@' && argv[i][1]) {
+            char path[2048], *buf, *text;
+            size_t len;
+
+            if (dir && !is_absolute_path(argv[i] + 1))
+                snprintf(path, sizeof(path), "%s/%s", dir, argv[i] + 1);
+            else
+                snprintf(path, sizeof(path), "%s", argv[i] + 1);
+            if ((buf = read_file_len(path, &len))) {
+                text = decode_text(buf, len);
+                free(buf);
+                if (DEBUG_LEVEL > 1)
+                    printf("Response file contents:\n%s\n", text);
+                files[i] = split_commandline(text, msvc, &counts[i]);
+                free(text);
+            }
+        }
+        if (files[i]) {
+            char **sub = expand_response_files(files[i], &counts[i], msvc,
+                                               dir, depth + 1);
+            if (sub != files[i]) {
+                free(files[i]);
+                files[i] = sub;
+            }
+            for (j = 0; j < counts[i]; j++)
+                size += strlen(files[i][j]) + 1;
+            n += counts[i];
+            expanded = 1;
+        } else {
+            size += strlen(argv[i]) + 1;
+            n++;
+        }
+    }
+
+    if (expanded && (out = malloc((n + 1) * sizeof(*out) + size))) {
+        str = (char *) (out + n + 1);
+        n = 0;
+        for (i = 0; i < *argc; i++) {
+            char **src = files[i] ? files[i] : &argv[i];
+            int count = files[i] ? counts[i] : 1;
+
+            for (j = 0; j < count; j++) {
+                out[n++] = str;
+                strcpy(str, src[j]);
+                str += strlen(str) + 1;
+            }
+            free(files[i]);
+        }
+        out[n] = NULL;
+        *argc = n;
+    } else {
+        for (i = 0; i < *argc; i++)
+            free(files[i]);
+        out = argv;
+    }
+    free(files);
+    free(counts);
+
+    return out;
+}
+static void make_dir(const char *path)
+{
+#ifdef _WIN32
+    _mkdir(path);
+#else
+    mkdir(path, 0777);
+#endif
+}
+
+static void remove_dir(const char *path)
+{
+#ifdef _WIN32
+    _rmdir(path);
+#else
+    rmdir(path);
+#endif
+}
+
+/*
+ * GNU make jobserver. make hands out job tokens through a pipe
+ * (--jobserver-auth=R,W), a fifo (--jobserver-auth=fifo:PATH) or, on
+ * Windows, a named semaphore, given in MAKEFLAGS. Like any job, we own one
+ * token already; each preprocessor, converter and compiler run takes a
+ * token, so that parallel conversions (commands with several sources,
+ * --compdb) stay within make's -j. Without a jobserver, the tokens are our
+ * own threads.
+ *
+ * libclang's memory use grows with the size of the translation unit, so
+ * with C99_TO_C89_WRAP_TOKEN_SIZE=<bytes>[k|M|G] a conversion takes one
+ * token per that many bytes of preprocessed source; memory rather than a
+ * fixed -j then bounds how many conversions run at a time.
+ */
+typedef struct {
+    int active;
+#ifdef _WIN32
+    HANDLE sem;
+#else
+    int rfd, wfd;
+    char held[256];         /* token bytes read, to be written back */
+    int n_held;
+#endif
+    int local, local_free;  /* our own tokens */
+    int borrowed;           /* tokens from make, all but ours */
+    int max_weight;         /* make's -j, or our own tokens */
+    size_t token_size;
+    unsigned seed;          /* for backing off at random */
+    Mutex lock;             /* protects local_free and held */
+    Mutex gather;           /* one thread at a time collects tokens */
+} Jobserver;
+
+static Jobserver jobserver;
+
+/* How long to wait for the rest of the tokens once some are held. Other
+ * jobs may be holding some and waiting just the same, so every
+ * JOBSERVER_BACKOFF seconds without a new token we give them back for a
+ * moment. */
+#define JOBSERVER_PATIENCE 5.0
+#define JOBSERVER_BACKOFF  0.2
+
+static void jobserver_init(void)
+{
+    const char *flags = getenv("MAKEFLAGS");
+    const char *envvar = getenv("C99_TO_C89_WRAP_TOKEN_SIZE");
+    const char *auth = NULL, *ptr;
+    char value[1024];
+    size_t len;
+
+    mutex_init(&jobserver.lock);
+    mutex_init(&jobserver.gather);
+    jobserver.local = jobserver.local_free = 1;
+    jobserver.max_weight = 1;
+    jobserver.seed = (unsigned) getpid() ^ (unsigned) ((long long) (get_time() * 1000));
+
+    if (envvar) {
+        char *end;
+
+        jobserver.token_size = strtoul(envvar, &end, 10);
+        if (*end == 'k' || *end == 'K')
+            jobserver.token_size <<= 10;
+        else if (*end == 'm' || *end == 'M')
+            jobserver.token_size <<= 20;
+        else if (*end == 'g' || *end == 'G')
+            jobserver.token_size <<= 30;
+    }
+
+    if (!flags)
+        return;
+    /* the last one counts; make before 4.2 calls it --jobserver-fds */
+    for (ptr = flags; (ptr = strstr(ptr, "--jobserver-")); ptr++) {
+        if (!strncmp(ptr, "--jobserver-auth=", 17))
+            auth = ptr + 17;
+        else if (!strncmp(ptr, "--jobserver-fds=", 16))
+            auth = ptr + 16;
+    }
+    if (!auth)
+        return;
+    len = strcspn(auth, " ");
+    if (len >= sizeof(value))
+        return;
+    memcpy(value, auth, len);
+    value[len] = '\0';
+
+    /* the other jobs hold a token each, so at most half of make's -j */
+    if ((ptr = strstr(flags, "-j")) && (ptr == flags || ptr[-1] == ' ') &&
+        atoi(ptr + 2) > 1)
+        jobserver.max_weight = atoi(ptr + 2) / 2;
+    else
+        jobserver.max_weight = 1 << 16;
+
+#ifdef _WIN32
+    jobserver.sem = OpenSemaphoreA(SEMAPHORE_ALL_ACCESS, FALSE, value);
+    jobserver.active = jobserver.sem != NULL;
+#else
+    if (!strncmp(value, "fifo:", 5)) {
+        jobserver.rfd = open(value + 5, O_RDONLY | O_NONBLOCK);
+        jobserver.wfd = open(value + 5, O_WRONLY);
+    } else {
+        char path[64];
+        int r, w;
+
+        /* make doesn't pass the pipe to commands it doesn't know to be
+         * recursive makes, so the descriptors may well be closed */
+        if (sscanf(value, "%d,%d", &r, &w) != 2 || r < 0 || w < 0 ||
+            fcntl(r, F_GETFD) < 0 || fcntl(w, F_GETFD) < 0) {
+            jobserver.max_weight = 1;
+            return;
+        }
+        /* the pipe is shared with make and the other jobs, so rather than
+         * make it nonblocking, open it anew where we can */
+        snprintf(path, sizeof(path), "/proc/self/fd/%d", r);
+        jobserver.rfd = open(path, O_RDONLY | O_NONBLOCK);
+        if (jobserver.rfd < 0)
+            jobserver.rfd = dup(r);
+        jobserver.wfd = dup(w);
+    }
+    jobserver.active = jobserver.rfd >= 0 && jobserver.wfd >= 0;
+#endif
+    if (!jobserver.active)
+        jobserver.max_weight = 1;
+    if (DEBUG_LEVEL > 0)
+        printf("jobserver %s: %s\n", value, jobserver.active ? "on" : "unavailable");
+}
+
+/* Without a jobserver, we may run n jobs at a time ourselves. */
+static void jobserver_local(int n)
+{
+    mutex_lock(&jobserver.lock);
+    if (!jobserver.active && n > jobserver.local) {
+        jobserver.local_free += n - jobserver.local;
+        jobserver.local = jobserver.max_weight = n;
+    }
+    mutex_unlock(&jobserver.lock);
+}
+
+static void sleep_ms(int ms)
+{
+#ifdef _WIN32
+    Sleep(ms);
+#else
+    usleep(ms * 1000);
+#endif
+}
+
+/* Waits up to ms milliseconds for a token from make. */
+static int jobserver_read(int ms)
+{
+#ifdef _WIN32
+    if (!jobserver.active) {
+        sleep_ms(ms);
+        return 0;
+    }
+    if (WaitForSingleObject(jobserver.sem, ms) != WAIT_OBJECT_0)
+        return 0;
+    mutex_lock(&jobserver.lock);
+    jobserver.borrowed++;
+    mutex_unlock(&jobserver.lock);
+    return 1;
+#else
+    struct pollfd pfd;
+    char c;
+
+    if (!jobserver.active) {
+        sleep_ms(ms);
+        return 0;
+    }
+    pfd.fd = jobserver.rfd;
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, ms) <= 0 || read(jobserver.rfd, &c, 1) != 1)
+        return 0;
+    mutex_lock(&jobserver.lock);
+    jobserver.borrowed++;
+    if (jobserver.n_held < (int) sizeof(jobserver.held))
+        jobserver.held[jobserver.n_held++] = c;
+    mutex_unlock(&jobserver.lock);
+    return 1;
+#endif
+}
+
+/* Some milliseconds, more the more attempts; call with the gather lock held. */
+static int jobserver_backoff(int attempt)
+{
+    jobserver.seed = jobserver.seed * 1103515245 + 12345;
+    return (jobserver.seed >> 16) % (50 << (attempt < 4 ? attempt : 4));
+}
+
+/* Gives n tokens back to make; call with jobserver.lock held. */
+static void jobserver_write(int n)
+{
+    jobserver.borrowed -= n;
+    for (; n > 0; n--) {
+#ifdef _WIN32
+        ReleaseSemaphore(jobserver.sem, 1, NULL);
+#else
+        char c = jobserver.n_held ? jobserver.held[--jobserver.n_held] : '+';
+        if (write(jobserver.wfd, &c, 1) != 1)
+            perror("jobserver");
+#endif
+    }
+}
+
+static void jobserver_release(int n)
+{
+    mutex_lock(&jobserver.lock);
+    for (; n > 0 && jobserver.local_free < jobserver.local; n--)
+        jobserver.local_free++;
+    jobserver_write(n);
+    mutex_unlock(&jobserver.lock);
+}
+
+/*
+ * Takes n tokens, our own first. Returns the number taken, to be given to
+ * jobserver_release(); fewer than n only after JOBSERVER_PATIENCE.
+ */
+static int jobserver_acquire(int n)
+{
+    int got = 0, attempt = 0;
+    double deadline = 0, backoff = 0;
+
+    if (n > jobserver.max_weight)
+        n = jobserver.max_weight;
+    mutex_lock(&jobserver.gather);
+    for (;;) {
+        mutex_lock(&jobserver.lock);
+        while (got < n && jobserver.local_free > 0) {
+            jobserver.local_free--;
+            got++;
+        }
+        mutex_unlock(&jobserver.lock);
+        if (got >= n)
+            break;
+        if (got && !deadline)
+            deadline = get_time() + JOBSERVER_PATIENCE;
+        else if (got && get_time() > deadline)
+            break;
+        /* short waits, as our own threads return tokens locally */
+        if (jobserver_read(got ? 50 : 10)) {
+            got++;
+            backoff = get_time() + JOBSERVER_BACKOFF;
+        } else if (got > 1 && get_time() > backoff) {
+            /* keep one, the rest of make's go back */
+            int back;
+
+            mutex_lock(&jobserver.lock);
+            back = got - 1 < jobserver.borrowed ? got - 1 : jobserver.borrowed;
+            jobserver_write(back);
+            jobserver.local_free += got - 1 - back;
+            mutex_unlock(&jobserver.lock);
+            got = 1;
+            sleep_ms(jobserver_backoff(attempt++));
+            backoff = get_time() + JOBSERVER_BACKOFF;
+        }
+    }
+    mutex_unlock(&jobserver.gather);
+
+    return got;
+}
+
+/* Tokens for converting size bytes of preprocessed source. */
+static int jobserver_weight(size_t size)
+{
+    if (!jobserver.token_size || size <= jobserver.token_size)
+        return 1;
+    return (int) ((size + jobserver.token_size - 1) / jobserver.token_size);
+}
+
+/* jobserver_acquire(), with waits of more than a millisecond traced */
+static int jobserver_acquire_traced(int n, const char *outname,
+                                    const char *file)
+{
+    double t0 = trace_time();
+    int tokens = jobserver_acquire(n);
+    double t1 = trace_time();
+
+    if (t1 - t0 > 0.001)
+        trace_event("wait for jobs", t0, t1, outname, file);
+    return tokens;
+}
+
+/*
+ * One source file of a compiler command line. A cl command may compile any
+ * number of them (with /MP, cl compiles them in parallel itself); they are
+ * preprocessed and converted in parallel by a pool of threads, and compiled
+ * with a single compiler command afterwards.
+ */
+typedef struct {
+    const char *source;
+    char preprocessed[2048], converted[2048];
+    int cc_index;           /* slot of the converted file in cc_argv */
+    int exit_code;
+    size_t preprocessed_size;
+    double t_preprocess, t_convert;
+} SourceJob;
+
+typedef struct {
+    SourceJob *sources;
+    int n_sources, next;
+    char **cpp_argv, **conv_argv; /* without the file names */
+    int cpp_argc, conv_argc;
+    const WrapContext *ctx;
+    Mutex lock;
+} SourcePool;
+
+static void convert_source(const SourcePool *pool, SourceJob *src)
+{
+    const WrapContext *ctx = pool->ctx;
+    char **cpp_argv  = malloc((pool->cpp_argc + 2) * sizeof(*cpp_argv));
+    char **conv_argv = malloc((pool->conv_argc + 3) * sizeof(*conv_argv));
+    char *preproc_out;
+    size_t preproc_len;
+    double t0, t1;
+    int tokens;
+
+    memcpy(cpp_argv, pool->cpp_argv, pool->cpp_argc * sizeof(*cpp_argv));
+    cpp_argv[pool->cpp_argc]     = (char *) src->source;
+    cpp_argv[pool->cpp_argc + 1] = NULL;
+
+    print_argv("cpp_argv", cpp_argv, pool->cpp_argc + 2, 0);
+    tokens = jobserver_acquire_traced(1, ctx->outname, src->source);
+    t0 = get_time();
+    src->exit_code = exec_argv_capture(cpp_argv, 0, &preproc_out, &preproc_len,
+                                       ctx->dir);
+    t1 = get_time();
+    src->t_preprocess = t1 - t0;
+    trace_event("preprocess", t0, t1, ctx->outname, src->source);
+    jobserver_release(tokens);
+    if (src->exit_code) {
+        if (ctx->keep && preproc_out)
+            write_file(preproc_out, preproc_len, src->preprocessed);
+        free(preproc_out);
+
+        goto exit;
+    }
+    /* VS2008 pre-processor does not remove line-continuations, so you end up with:
+    #pragma comment(linker,"/manifestdependency:\"type='win32' " \
+                    "name='" "Microsoft.VC90" ".DebugCRT' " \
+                                        "version='" "9.0.21022.8" "' " \
+                                        "processorArchitecture='amd64' " \
+                                        "publicKeyToken='" "1fc8b3b9a1e18e3b" "'\"")
+        .. and then clang will remove these continuations and the compiler cannot handle that
+        (because it's not valid).
+    */
+    /* Two line ending styles to allow for other shells, nasty but this caused me a lot of trouble */
+    static char line_cont1[] = "\\\r\n";
+    static char line_cont2[] = "\\\n";
+    /* We also remove #pragma once which is invalid in .c files and creates very noisy logs */
+    static char pragma_once1[] = "#pragma once\r\n";
+    static char pragma_once2[] = "#pragma once\n";
+    size_t initialsz;
+    t0 = trace_time();
+    size_t finalsz1 = remove_string(preproc_out, line_cont1, &initialsz);
+    t1 = trace_time();
+    trace_event("remove line continuations (CRLF)", t0, t1, ctx->outname,
+                src->source);
+    size_t finalsz2 = remove_string(preproc_out, line_cont2, &finalsz1);
+    t0 = trace_time();
+    trace_event("remove line continuations (LF)", t1, t0, ctx->outname,
+                src->source);
+    size_t finalsz3 = remove_string(preproc_out, pragma_once1, &finalsz2);
+    t1 = trace_time();
+    trace_event("remove #pragma once (CRLF)", t0, t1, ctx->outname,
+                src->source);
+    size_t finalsz4 = remove_string(preproc_out, pragma_once2, &finalsz3);
+    t0 = trace_time();
+    trace_event("remove #pragma once (LF)", t1, t0, ctx->outname,
+                src->source);
+    if (ctx->update)
+        update_file(preproc_out, finalsz4 - 1, src->preprocessed);
+    else
+        write_file(preproc_out, finalsz4 - 1, src->preprocessed);
+    src->preprocessed_size = finalsz4 - 1;
+    free(preproc_out);
+    trace_event("write preprocessed", t0, trace_time(), ctx->outname,
+                src->preprocessed);
+
+    memcpy(conv_argv, pool->conv_argv, pool->conv_argc * sizeof(*conv_argv));
+    conv_argv[pool->conv_argc]     = src->preprocessed;
+    conv_argv[pool->conv_argc + 1] = src->converted;
+    conv_argv[pool->conv_argc + 2] = NULL;
+
+    tokens = jobserver_acquire_traced(jobserver_weight(src->preprocessed_size),
+                                      ctx->outname, src->preprocessed);
+    t0 = get_time();
+    src->exit_code = exec_argv_out(conv_argv, 0, NULL, ctx->dir);
+    t1 = get_time();
+    src->t_convert = t1 - t0;
+    trace_event("convert", t0, t1, ctx->outname, src->converted);
+    jobserver_release(tokens);
+    print_argv("conv_argv", conv_argv, pool->conv_argc + 2, 0);
+    if (src->exit_code && !ctx->keep)
+        unlink(src->converted);
+
+    if (!ctx->keep)
+        unlink(src->preprocessed);
+
+exit:
+    free(cpp_argv);
+    free(conv_argv);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall source_worker(void *arg)
+#else
+static void *source_worker(void *arg)
+#endif
+{
+    SourcePool *pool = arg;
+
+    for (;;) {
+        int n;
+
+        mutex_lock(&pool->lock);
+        n = pool->next < pool->n_sources ? pool->next++ : -1;
+        mutex_unlock(&pool->lock);
+        if (n < 0)
+            break;
+        convert_source(pool, &pool->sources[n]);
+    }
+
+    return 0;
+}
+
+/* Converts the sources of pool on up to n_threads threads. */
+static void convert_sources(SourcePool *pool, int n_threads)
+{
+    Thread *threads;
+    int n;
+
+    if (n_threads > pool->n_sources)
+        n_threads = pool->n_sources;
+    pool->next = 0;
+    jobserver_local(n_threads);
+    mutex_init(&pool->lock);
+    if (n_threads <= 1) {
+        source_worker(pool);
+        mutex_destroy(&pool->lock);
+        return;
+    }
+
+    threads = malloc(n_threads * sizeof(*threads));
+    for (n = 0; n < n_threads; n++) {
+#ifdef _WIN32
+        threads[n] = (HANDLE) _beginthreadex(NULL, 0, source_worker,
+                                             pool, 0, NULL);
+        if (!threads[n]) {
+#else
+        if (pthread_create(&threads[n], NULL, source_worker, pool)) {
+#endif
+            fprintf(stderr, "Unable to create worker thread\n");
+            exit(1);
+        }
+    }
+    for (n = 0; n < n_threads; n++) {
+#ifdef _WIN32
+        WaitForSingleObject(threads[n], INFINITE);
+        CloseHandle(threads[n]);
+#else
+        pthread_join(threads[n], NULL);
+#endif
+    }
+    mutex_destroy(&pool->lock);
+    free(threads);
+}
+
+/*
+ * Preprocesses, converts and compiles the compiler command line argv
+ * (argv[0] is the compiler); anything else is passed through as it is.
+ */
+static int wrap_command(int argc, char **argv, WrapContext *ctx)
+{
+    int i = 0;
+    int cpp_argc, cc_argc, pass_argc;
+    int exit_code;
+    int input_source = 0, input_obj = 0;
+    int msvc = 0, icl = 0, flag_compile = 0;
+    char temp_dir[2048] = "",
+         fo_buffer[2048], fi_buffer[2048], pid_name[64];
+    char **cpp_argv, **cc_argv, **pass_argv, **bitness_argv;
+    char *conv_argv[7];
+    SourceJob *sources;
+    SourcePool pool;
+    int n_sources = 0, n_threads = 0, tokens;
+    const char *compiler;
+    const char *outname = NULL;
+    const char *profile = ctx->profile;
+    char **response_argv;
+    char convert_options[20] = "";
+    char convert_bitness[4] = "-64";
+    char profile_option[64] = "";
+    int bits_32, cl_major, conv_argc;
+    double t0, t_probe = 0, t_probe_end = 0;
+
+    /* the compiler may be given with its path, e.g. in compile_commands.json */
+    compiler = argv[0] + strlen(argv[0]);
+    while (compiler > argv[0] && compiler[-1] != '/' && compiler[-1] != '\\')
+        compiler--;
+    if (!strncmp(compiler, "cl", 2) && (compiler[2] == '.' || compiler[2] == '\0')) {
+        msvc = 1;
+        strcpy(convert_options, "-ms");
+    } else if (!strncmp(compiler, "icl", 3) && (compiler[3] == '.' || compiler[3] == '\0')) {
+        msvc = 1; /* for command line compatibility */
+        icl = 1;
+    }
+
+    /* Are we using response files? If so reform argv and argc from them. */
+    response_argv = expand_response_files(argv, &argc, msvc, ctx->dir, 0);
+    if (response_argv != argv) {
+        argv = response_argv;
+        i = 0;
+        /* Print the commandline as this is one of the most difficult aspects of dealing
+        with CMake on Windows. If it uses a response file (often it will) you are forced
+        to use something like procmon to see the flags passed. */
+        if (icl == 0)
+            printf("c99wrap cl ");
+        else
+            printf("c99wrap icl ");
+        print_argv("argv", argv + 1, argc - 1, 1);
+    } else {
+        response_argv = NULL;
+    }
+
+
+    cpp_argv     = malloc((argc + 2) * sizeof(*cpp_argv));
+    cc_argv      = malloc((argc + 3) * sizeof(*cc_argv));
+    pass_argv    = malloc((argc + 3) * sizeof(*pass_argv));
+    sources      = malloc(argc * sizeof(*sources));
+    bitness_argv = malloc(2 * sizeof(*bitness_argv));
     if (icl)
         bitness_argv[0] = "icl";
     else
         bitness_argv[0] = "cl";
     bitness_argv[1] = NULL;
-    exec_argv_out(bitness_argv, 1, temp_file_3);
-    char * bitness_out = read_file(temp_file_3);
-    if (bitness_out != NULL && strstr(bitness_out, "80x86"))
+    if (ctx->probed) {
+        bits_32 = ctx->bits_32;
+        cl_major = ctx->cl_major;
+    } else {
+        t_probe = trace_time();
+        probe_compiler(bitness_argv, &bits_32, &cl_major);
+        t_probe_end = trace_time();
+    }
+    if (bits_32)
         strcpy(convert_bitness, "-32");
-    unlink(temp_file_3);
+    /* cl 18 is VS2013, cl 19 VS2015 and later; see c99conv -profile= */
+    if (!profile && msvc && !icl)
+        profile = cl_major >= 19 ? "vs2015" : cl_major == 18 ? "vs2013" : NULL;
+    if (profile && profile[0])
+        snprintf(profile_option, sizeof(profile_option), "-profile=%s", profile);
 
     cpp_argc = cc_argc = pass_argc = 0;
 
@@ -523,9 +1613,8 @@ int main(int argc, char *argv[])
             if (!strcmp(ext, ".c") || !strcmp(ext, ".s") || !strcmp(ext, ".S")) {
                 ext_inputfile = 1;
                 input_source  = 1;
-                source_file   = argv[i];
             } else if (!strcmp(ext, ".o") && argv[i][0] != '/' && argv[i][0] != '-') {
-                ext_inputfile = 1;
+                ext_inputfile = 2;
                 input_obj     = 1;
             }
         }
@@ -578,12 +1667,6 @@ int main(int argc, char *argv[])
                 }
             }
 
-            /* Set easier to understand temp file names. temp_file_2 might
-             * have been set in cc_argv already, but we're just updating
-             * the same buffer. */
-            sprintf(temp_file_1, "%s_preprocessed.c", outname);
-            sprintf(temp_file_2, "%s_converted.c", outname);
-
         } else if (!flagstrcmp(argv[i], "-c")) {
             // Copy the compile flag only to cc, set the preprocess flag for cpp
             pass_argv[pass_argc++] = argv[i];
@@ -594,14 +1677,25 @@ int main(int argc, char *argv[])
             else
                 cpp_argv[cpp_argc++] = "-EP";
 
-            if (!noconv)
+            if (!ctx->noconv)
                 flag_compile = 1;
-        } else if (ext_inputfile) {
-            // Input filename, pass to cpp only, set the temp file input to cc
+        } else if (ext_inputfile == 1) {
+            // Source file, preprocessed on its own; cc gets the converted file, see below
+            sources[n_sources].source   = argv[i];
+            sources[n_sources].cc_index = cc_argc;
+            n_sources++;
             pass_argv[pass_argc++] = argv[i];
-            cpp_argv[cpp_argc++]   = argv[i++];
-            cc_argv[cc_argc++]     = temp_file_2;
-        } else if (!flagstrcmp(argv[i], "-MMD") || !flagstrncmp(argv[i], "-D", 2)) {
+            cc_argv[cc_argc++]     = argv[i++];
+        } else if (ext_inputfile == 2) {
+            // Object file, only for cc
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++]     = argv[i++];
+        } else if (msvc && !flagstrncmp(argv[i], "-MP", 3)) {
+            // Parallel compilation, for cc; we convert that many sources at a time
+            n_threads = argv[i][3] ? atoi(argv[i] + 3) : 0;
+            pass_argv[pass_argc++] = argv[i];
+            cc_argv[cc_argc++]     = argv[i++];
+        } else if (!flagstrcmp(argv[i], "-MMD") || !flagstrncmp(argv[i], "-D", 2)) {
             // Preprocessor-only parameter
             if (!flagstrcmp(argv[i], "-D")) {
                 // Handle -D DEFINE style
@@ -637,84 +1731,910 @@ int main(int argc, char *argv[])
     cc_argv[cc_argc++]     = NULL;
     pass_argv[pass_argc++] = NULL;
 
-    if (!flag_compile || !source_file || !outname) {
+    ctx->outname = outname ? outname : n_sources ? sources[0].source : NULL;
+    if (t_probe)
+        trace_event("probe compiler", t_probe, t_probe_end, ctx->outname,
+                    bitness_argv[0]);
+
+    if (!flag_compile || !n_sources || (n_sources == 1 && !outname)) {
         print_argv("pass_argv", pass_argv, pass_argc, 0);
         /* Doesn't seem like we should be invoked, just call the parameters as such */
-        exit_code = exec_argv_out(pass_argv, 0, NULL);
+        tokens = jobserver_acquire_traced(1, ctx->outname, NULL);
+        t0 = trace_time();
+        exit_code = exec_argv_out(pass_argv, 0, NULL, ctx->dir);
+        trace_event("pass through", t0, trace_time(), ctx->outname, NULL);
+        jobserver_release(tokens);
 
         goto exit;
     }
 
-    print_argv("cpp_argv", cpp_argv, cpp_argc, 0);
-    exit_code = exec_argv_out(cpp_argv, 0, temp_file_1);
-    if (exit_code) {
-        if (!keep)
-            unlink(temp_file_1);
+    if (n_sources == 1 && outname[0] && !strchr("/\\", outname[strlen(outname) - 1])) {
+        /* Easier to understand temp file names */
+        if (temp_name(sources[0].preprocessed, sizeof(sources[0].preprocessed),
+                      ctx, outname, "_preprocessed.c") ||
+            temp_name(sources[0].converted, sizeof(sources[0].converted),
+                      ctx, outname, "_converted.c")) {
+            exit_code = 1;
+            goto exit;
+        }
+    } else {
+        /* Each converted file keeps the base name of its source, in a
+         * directory of its own, so the compiler names the objects (in
+         * the -Fo directory) after the sources. */
+        sprintf(pid_name, "c99wrap_%d%s", (int) getpid(), ctx->tag);
+        if (temp_name(temp_dir, sizeof(temp_dir), ctx, pid_name, "")) {
+            exit_code = 1;
+            goto exit;
+        }
+        /* all names are checked before any directory is made */
+        for (i = 0; i < n_sources; i++) {
+            const char *base = sources[i].source + strlen(sources[i].source);
+            int len1, len2;
+
+            while (base > sources[i].source && base[-1] != '/' && base[-1] != '\\')
+                base--;
+            len1 = snprintf(sources[i].preprocessed, sizeof(sources[i].preprocessed),
+                            "%s/%d/preprocessed_%s", temp_dir, i, base);
+            len2 = snprintf(sources[i].converted, sizeof(sources[i].converted),
+                            "%s/%d/%s", temp_dir, i, base);
+            if (len1 < 0 || len1 >= (int) sizeof(sources[i].preprocessed) ||
+                len2 < 0 || len2 >= (int) sizeof(sources[i].converted)) {
+                fprintf(stderr, "Temp file name too long for %s\n",
+                        sources[i].source);
+                temp_dir[0] = '\0';
+                exit_code = 1;
+                goto exit;
+            }
+        }
+        make_dir(temp_dir);
+        for (i = 0; i < n_sources; i++) {
+            /* <temp_dir>/<i>, from the converted file name */
+            char *sep = strrchr(sources[i].converted, '/');
+
+            *sep = '\0';
+            make_dir(sources[i].converted);
+            *sep = '/';
+        }
+    }
 
-        goto exit;
+    conv_argc = 0;
+    conv_argv[conv_argc++] = (char *) ctx->conv_tool;
+    if (convert_options[0])
+        conv_argv[conv_argc++] = convert_options;
+    conv_argv[conv_argc++] = convert_bitness;
+    if (profile_option[0])
+        conv_argv[conv_argc++] = profile_option;
+    if (ctx->update)
+        conv_argv[conv_argc++] = "-update";
+    if (ctx->compact)
+        conv_argv[conv_argc++] = "-compact";
+
+    pool.sources   = sources;
+    pool.n_sources = n_sources;
+    pool.cpp_argv  = cpp_argv;
+    pool.cpp_argc  = cpp_argc - 1;
+    pool.conv_argv = conv_argv;
+    pool.conv_argc = conv_argc;
+    pool.ctx       = ctx;
+    convert_sources(&pool, n_threads > 0 ? n_threads : (int) cpu_count());
+
+    exit_code = 0;
+    for (i = 0; i < n_sources; i++) {
+        ctx->preprocessed_size += sources[i].preprocessed_size;
+        ctx->t_preprocess += sources[i].t_preprocess;
+        ctx->t_convert += sources[i].t_convert;
+        if (sources[i].exit_code && !exit_code)
+            exit_code = sources[i].exit_code;
+        cc_argv[sources[i].cc_index] = sources[i].converted;
     }
-    /* VS2008 pre-processor does not remove line-continuations, so you end up with:
-    #pragma comment(linker,"/manifestdependency:\"type='win32' " \
-                    "name='" "Microsoft.VC90" ".DebugCRT' " \
-                                        "version='" "9.0.21022.8" "' " \
-                                        "processorArchitecture='amd64' " \
-                                        "publicKeyToken='" "1fc8b3b9a1e18e3b" "'\"")
-        .. and then clang will remove these continuations and the compiler cannot handle that
-        (because it's not valid).
-    */
-    char * preproc_out = read_file(temp_file_1);
-    if (preproc_out == NULL) {
-        exit_code = 1;
-        goto exit;
+
+    if (!exit_code) {
+        tokens = jobserver_acquire_traced(1, ctx->outname, NULL);
+        t0 = get_time();
+        exit_code = exec_argv_out(cc_argv, 0, NULL, ctx->dir);
+        ctx->t_compile = get_time() - t0;
+        trace_event("compile", t0, t0 + ctx->t_compile, ctx->outname, NULL);
+        jobserver_release(tokens);
     }
-    /* Two line ending styles to allow for other shells, nasty but this caused me a lot of trouble */
-    static char line_cont1[] = "\\\r\n";
-    static char line_cont2[] = "\\\n";
-    /* We also remove #pragma once which is invalid in .c files and creates very noisy logs */
-    static char pragma_once1[] = "#pragma once\r\n";
-    static char pragma_once2[] = "#pragma once\n";
-    size_t initialsz;
-    size_t finalsz1 = remove_string(preproc_out, line_cont1, &initialsz);
-    size_t finalsz2 = remove_string(preproc_out, line_cont2, &finalsz1);
-    size_t finalsz3 = remove_string(preproc_out, pragma_once1, &finalsz2);
-    size_t finalsz4 = remove_string(preproc_out, pragma_once2, &finalsz3);
-    if (finalsz4 != initialsz) {
-        write_file(preproc_out, finalsz4 - 1, temp_file_1);
+
+    if (!ctx->keep) {
+        for (i = 0; i < n_sources; i++)
+            unlink(sources[i].converted);
+        if (temp_dir[0]) {
+            for (i = 0; i < n_sources; i++) {
+                *strrchr(sources[i].converted, '/') = '\0';
+                remove_dir(sources[i].converted);
+            }
+            remove_dir(temp_dir);
+        }
+    }
+
+exit:
+    free(sources);
+    free(cc_argv);
+    free(cpp_argv);
+    free(pass_argv);
+    free(bitness_argv);
+    free(response_argv);
+
+    return exit_code ? 1 : 0;
+}
+
+/*
+ * --compdb: converts and compiles all entries of a compile_commands.json
+ * on a pool of threads, without a build system (and a c99wrap process)
+ * per file. Each worker owns a deque of jobs, dealt in longest-first order
+ * by the preprocessed size recorded in the previous report (the source
+ * size for new files). A worker whose deque runs dry steals the longest
+ * job left in the other deques, so that the big files start first and the
+ * small ones fill the gaps at the end.
+ */
+typedef struct {
+    char *directory, *file;
+    char **argv;
+    int argc;
+    double estimate;        /* bytes, see above */
+    int worker, stolen, done;
+    int exit_code;
+    double start, seconds;
+    WrapContext ctx;
+    char tag[32];
+} CompdbJob;
+
+typedef struct {
+    Mutex lock;
+    unsigned *jobs;         /* indices, longest first */
+    unsigned head, tail;
+} JobDeque;
+
+typedef struct {
+    CompdbJob *jobs;
+    unsigned n_jobs;
+    JobDeque *deques;
+    unsigned n_workers;
+    const WrapContext *base;
+    const char *report;
+    Mutex lock;             /* protects the fields below and the report */
+    unsigned n_done, n_failed;
+    double start, last_report;
+} Compdb;
+
+typedef struct {
+    const char *p, *end;
+    int error;
+} JsonParser;
+
+static void json_skip_space(JsonParser *j)
+{
+    while (j->p < j->end && (*j->p == ' ' || *j->p == '\t' ||
+                             *j->p == '\n' || *j->p == '\r'))
+        j->p++;
+}
+
+static int json_expect(JsonParser *j, char c)
+{
+    json_skip_space(j);
+    if (j->p < j->end && *j->p == c) {
+        j->p++;
+        return 1;
+    }
+    j->error = 1;
+    return 0;
+}
+
+/* Returns the decoded string (UTF-8) at j->p, or NULL. */
+static char *json_string(JsonParser *j)
+{
+    char *str, *d;
+
+    if (!json_expect(j, '"'))
+        return NULL;
+    /* decoding never makes a string longer */
+    str = d = malloc(j->end - j->p + 1);
+    if (!str) {
+        j->error = 1;
+        return NULL;
+    }
+    while (j->p < j->end && *j->p != '"') {
+        char c = *j->p++;
+        if (c == '\\' && j->p < j->end) {
+            c = *j->p++;
+            switch (c) {
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'u': {
+                unsigned u = 0;
+                int n;
+                for (n = 0; n < 4 && j->p < j->end; n++, j->p++) {
+                    char h = *j->p;
+                    u = u * 16 + (h >= 'a' ? h - 'a' + 10 :
+                                  h >= 'A' ? h - 'A' + 10 : h - '0');
+                }
+                /* no surrogate pairs; paths rarely need them */
+                if (u < 0x80) {
+                    *d++ = (char) u;
+                } else if (u < 0x800) {
+                    *d++ = (char) (0xc0 | (u >> 6));
+                    *d++ = (char) (0x80 | (u & 0x3f));
+                } else {
+                    *d++ = (char) (0xe0 | (u >> 12));
+                    *d++ = (char) (0x80 | ((u >> 6) & 0x3f));
+                    *d++ = (char) (0x80 | (u & 0x3f));
+                }
+                continue;
+            }
+            default: break; /* '"', '\\' and '/' */
+            }
+        }
+        *d++ = c;
+    }
+    *d = '\0';
+    if (!json_expect(j, '"')) {
+        free(str);
+        return NULL;
     }
+    return str;
+}
 
-    conv_argv[0] = conv_tool;
-    conv_argv[1] = convert_options;
-    conv_argv[2] = convert_bitness;
-    conv_argv[3] = temp_file_1;
-    conv_argv[4] = temp_file_2;
-    conv_argv[5] = NULL;
+static void json_skip_value(JsonParser *j)
+{
+    json_skip_space(j);
+    if (j->p == j->end) {
+        j->error = 1;
+    } else if (*j->p == '"') {
+        free(json_string(j));
+    } else if (*j->p == '[' || *j->p == '{') {
+        char close = *j->p == '[' ? ']' : '}';
+        j->p++;
+        json_skip_space(j);
+        if (j->p < j->end && *j->p == close) {
+            j->p++;
+            return;
+        }
+        while (!j->error) {
+            if (close == '}') {
+                free(json_string(j));
+                json_expect(j, ':');
+            }
+            json_skip_value(j);
+            json_skip_space(j);
+            if (j->p < j->end && *j->p == ',')
+                j->p++;
+            else
+                break;
+        }
+        json_expect(j, close);
+    } else {
+        /* number, true, false or null */
+        while (j->p < j->end && !strchr(",]} \t\r\n", *j->p))
+            j->p++;
+    }
+}
 
-    exit_code = exec_argv_out(conv_argv, 0, NULL);
-    print_argv("conv_argv", conv_argv, 5, 0);
-    if (exit_code) {
-        if (!keep) {
-            unlink(temp_file_1);
-            unlink(temp_file_2);
+/*
+ * Calls member() for each "key": value of the object at j->p, which must
+ * consume the value (e.g. with json_skip_value()).
+ */
+static void json_object(JsonParser *j,
+                        void (*member)(JsonParser *j, const char *key,
+                                       void *opaque),
+                        void *opaque)
+{
+    if (!json_expect(j, '{'))
+        return;
+    json_skip_space(j);
+    if (j->p < j->end && *j->p == '}') {
+        j->p++;
+        return;
+    }
+    while (!j->error) {
+        char *key = json_string(j);
+        if (!key || !json_expect(j, ':')) {
+            free(key);
+            return;
         }
+        member(j, key, opaque);
+        free(key);
+        json_skip_space(j);
+        if (j->p < j->end && *j->p == ',')
+            j->p++;
+        else
+            break;
+    }
+    json_expect(j, '}');
+}
 
-        goto exit;
+/* Calls element() for each value of the array at j->p. */
+static void json_array(JsonParser *j,
+                       void (*element)(JsonParser *j, void *opaque),
+                       void *opaque)
+{
+    if (!json_expect(j, '['))
+        return;
+    json_skip_space(j);
+    if (j->p < j->end && *j->p == ']') {
+        j->p++;
+        return;
+    }
+    while (!j->error) {
+        element(j, opaque);
+        json_skip_space(j);
+        if (j->p < j->end && *j->p == ',')
+            j->p++;
+        else
+            break;
     }
+    json_expect(j, ']');
+}
 
-    if (!keep)
-        unlink(temp_file_1);
+static void write_json_string(FILE *f, const char *str)
+{
+    fputc('"', f);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            fprintf(f, "\\%c", *str);
+        else if ((unsigned char) *str < 0x20)
+            fprintf(f, "\\u%04x", (unsigned char) *str);
+        else
+            fputc(*str, f);
+    }
+    fputc('"', f);
+}
 
-    exit_code = exec_argv_out(cc_argv, 0, NULL);
+typedef struct {
+    CompdbJob job;
+    char *command;
+} EntryParser;
 
-    if (!keep)
-        unlink(temp_file_2);
+static void parse_argument(JsonParser *j, void *opaque)
+{
+    CompdbJob *job = opaque;
+    char *arg = json_string(j);
+    char **mem;
 
-exit:
-    free(cc_argv);
-    free(cpp_argv);
-    free(pass_argv);
+    if (!arg)
+        return;
+    mem = realloc(job->argv, (job->argc + 2) * sizeof(*job->argv));
+    if (!mem) {
+        j->error = 1;
+        free(arg);
+        return;
+    }
+    job->argv = mem;
+    job->argv[job->argc++] = arg;
+    job->argv[job->argc] = NULL;
+}
+
+static void parse_entry_member(JsonParser *j, const char *key, void *opaque)
+{
+    EntryParser *e = opaque;
+
+    if (!strcmp(key, "directory")) {
+        free(e->job.directory);
+        e->job.directory = json_string(j);
+    } else if (!strcmp(key, "file")) {
+        free(e->job.file);
+        e->job.file = json_string(j);
+    } else if (!strcmp(key, "command")) {
+        free(e->command);
+        e->command = json_string(j);
+    } else if (!strcmp(key, "arguments")) {
+        json_array(j, parse_argument, &e->job);
+    } else {
+        json_skip_value(j);
+    }
+}
+
+static void parse_entry(JsonParser *j, void *opaque)
+{
+    Compdb *db = opaque;
+    EntryParser e;
+    CompdbJob *mem;
+
+    memset(&e, 0, sizeof(e));
+    json_object(j, parse_entry_member, &e);
+    if (!e.job.argv && e.command) {
+        /* "command" is a shell-escaped string, or on Windows, a command line */
+#ifdef _WIN32
+        e.job.argv = split_commandline(e.command, 1, &e.job.argc);
+#else
+        e.job.argv = split_commandline(e.command, 0, &e.job.argc);
+#endif
+    }
+    free(e.command);
+    if (j->error || !e.job.argv || !e.job.argc || !e.job.directory ||
+        !e.job.file) {
+        fprintf(stderr, "Ignoring incomplete compile_commands.json entry\n");
+        return; /* the strings leak, but we don't go on anyway */
+    }
+
+    mem = realloc(db->jobs, (db->n_jobs + 1) * sizeof(*db->jobs));
+    if (!mem) {
+        j->error = 1;
+        return;
+    }
+    db->jobs = mem;
+    db->jobs[db->n_jobs++] = e.job;
+}
+
+typedef struct {
+    char *directory, *file;
+    double preprocessed_size;
+} ReportEntry;
+
+static void parse_report_member(JsonParser *j, const char *key, void *opaque)
+{
+    ReportEntry *r = opaque;
+
+    if (!strcmp(key, "directory")) {
+        r->directory = json_string(j);
+    } else if (!strcmp(key, "file")) {
+        r->file = json_string(j);
+    } else if (!strcmp(key, "preprocessed_size")) {
+        json_skip_space(j);
+        r->preprocessed_size = strtod(j->p, NULL);
+        json_skip_value(j);
+    } else {
+        json_skip_value(j);
+    }
+}
+
+static void parse_report_file(JsonParser *j, void *opaque)
+{
+    Compdb *db = opaque;
+    ReportEntry r;
+    unsigned n;
+
+    memset(&r, 0, sizeof(r));
+    json_object(j, parse_report_member, &r);
+    for (n = 0; r.directory && r.file && r.preprocessed_size > 0 &&
+                n < db->n_jobs; n++) {
+        CompdbJob *job = &db->jobs[n];
+        if (!strcmp(job->directory, r.directory) && !strcmp(job->file, r.file))
+            job->estimate = r.preprocessed_size;
+    }
+    free(r.directory);
+    free(r.file);
+}
+
+static void parse_report_member_top(JsonParser *j, const char *key,
+                                    void *opaque)
+{
+    if (!strcmp(key, "files"))
+        json_array(j, parse_report_file, opaque);
+    else
+        json_skip_value(j);
+}
+
+/* Job size estimates from the previous report, or from the sources. */
+static void estimate_jobs(Compdb *db)
+{
+    char *report = db->report ? read_file(db->report) : NULL;
+    unsigned n;
+
+    if (report) {
+        JsonParser j = { report, report + strlen(report), 0 };
+        json_object(&j, parse_report_member_top, db);
+        free(report);
+    }
+    for (n = 0; n < db->n_jobs; n++) {
+        CompdbJob *job = &db->jobs[n];
+        char path[4096];
+        struct stat st;
+
+        if (job->estimate > 0)
+            continue;
+        if (is_absolute_path(job->file))
+            snprintf(path, sizeof(path), "%s", job->file);
+        else
+            snprintf(path, sizeof(path), "%s/%s", job->directory, job->file);
+        job->estimate = stat(path, &st) ? 0 : (double) st.st_size;
+    }
+}
+
+/* Writes the report atomically, so that it can be watched for progress. */
+static void write_report(Compdb *db, int finished)
+{
+    char tmp[4096];
+    unsigned n;
+    FILE *f;
+
+    snprintf(tmp, sizeof(tmp), "%s.tmp", db->report);
+    if (!(f = fopen(tmp, "w"))) {
+        perror(tmp);
+        return;
+    }
+    fprintf(f, "{\n  \"finished\": %s,\n  \"jobs\": %u,\n  \"workers\": %u,\n"
+            "  \"done\": %u,\n  \"failed\": %u,\n  \"seconds\": %.3f,\n"
+            "  \"files\": [", finished ? "true" : "false", db->n_jobs,
+            db->n_workers, db->n_done, db->n_failed, get_time() - db->start);
+    for (n = 0; n < db->n_jobs; n++) {
+        CompdbJob *job = &db->jobs[n];
+
+        fprintf(f, "%s\n    { \"file\": ", n ? "," : "");
+        write_json_string(f, job->file);
+        fprintf(f, ", \"directory\": ");
+        write_json_string(f, job->directory);
+        if (!job->done) {
+            fprintf(f, ", \"status\": \"%s\" }", job->start > 0 ? "running" : "queued");
+            continue;
+        }
+        fprintf(f, ", \"status\": \"done\", \"exit_code\": %d, "
+                "\"preprocessed_size\": %lu, \"start\": %.3f, \"seconds\": %.3f, "
+                "\"preprocess_seconds\": %.3f, \"convert_seconds\": %.3f, "
+                "\"compile_seconds\": %.3f, \"worker\": %d, \"stolen\": %s }",
+                job->exit_code, (unsigned long) job->ctx.preprocessed_size,
+                job->start - db->start, job->seconds, job->ctx.t_preprocess,
+                job->ctx.t_convert, job->ctx.t_compile, job->worker,
+                job->stolen ? "true" : "false");
+    }
+    fprintf(f, "\n  ]\n}\n");
+    fclose(f);
+#ifdef _WIN32
+    if (!MoveFileExA(tmp, db->report, MOVEFILE_REPLACE_EXISTING))
+#else
+    if (rename(tmp, db->report))
+#endif
+        perror(db->report);
+}
+
+/* The next job for worker w: its own longest, or the longest elsewhere. */
+static CompdbJob *next_job(Compdb *db, unsigned w)
+{
+    JobDeque *own = &db->deques[w];
+    unsigned n, victim = (unsigned) -1;
+    double longest = -1;
+    CompdbJob *job = NULL;
+
+    mutex_lock(&own->lock);
+    if (own->head < own->tail)
+        job = &db->jobs[own->jobs[own->head++]];
+    mutex_unlock(&own->lock);
+    if (job)
+        return job;
+
+    /* the victim may run out before the steal below, which rechecks */
+    for (n = 0; n < db->n_workers; n++) {
+        JobDeque *d = &db->deques[n];
+        if (n == w)
+            continue;
+        mutex_lock(&d->lock);
+        if (d->head < d->tail &&
+            db->jobs[d->jobs[d->head]].estimate > longest) {
+            longest = db->jobs[d->jobs[d->head]].estimate;
+            victim = n;
+        }
+        mutex_unlock(&d->lock);
+    }
+    if (victim == (unsigned) -1)
+        return NULL;
+    mutex_lock(&db->deques[victim].lock);
+    if (db->deques[victim].head < db->deques[victim].tail) {
+        job = &db->jobs[db->deques[victim].jobs[db->deques[victim].head++]];
+        job->stolen = 1;
+    }
+    mutex_unlock(&db->deques[victim].lock);
+
+    /* lost the race: look again */
+    return job ? job : next_job(db, w);
+}
+
+typedef struct {
+    Compdb *db;
+    unsigned index;
+} Worker;
+
+#ifdef _WIN32
+static unsigned __stdcall compdb_worker(void *arg)
+#else
+static void *compdb_worker(void *arg)
+#endif
+{
+    Worker *worker = arg;
+    Compdb *db = worker->db;
+    CompdbJob *job;
+
+    while ((job = next_job(db, worker->index))) {
+        mutex_lock(&db->lock);
+        job->start = get_time();
+        job->worker = worker->index;
+        mutex_unlock(&db->lock);
+
+        job->ctx = *db->base;
+        job->ctx.dir = job->directory;
+        snprintf(job->tag, sizeof(job->tag), "_%u", (unsigned) (job - db->jobs));
+        job->ctx.tag = job->tag;
+        job->exit_code = wrap_command(job->argc, job->argv, &job->ctx);
+
+        mutex_lock(&db->lock);
+        job->seconds = get_time() - job->start;
+        job->done = 1;
+        db->n_done++;
+        db->n_failed += job->exit_code != 0;
+        printf("[%u/%u] %s%s (%.2fs)\n", db->n_done, db->n_jobs, job->file,
+               job->exit_code ? " FAILED" : "", job->seconds);
+        fflush(stdout);
+        if (db->report && get_time() - db->last_report >= 1.0) {
+            write_report(db, 0);
+            db->last_report = get_time();
+        }
+        mutex_unlock(&db->lock);
+    }
+
+    return 0;
+}
+
+static const CompdbJob *sort_jobs; /* for compare_jobs() */
+
+/* longest first */
+static int compare_jobs(const void *a, const void *b)
+{
+    double x = sort_jobs[*(const unsigned *) a].estimate;
+    double y = sort_jobs[*(const unsigned *) b].estimate;
+
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static int run_compdb(const char *file, unsigned n_workers,
+                      const char *report, WrapContext *base)
+{
+    Compdb db;
+    Worker *workers;
+    Thread *threads;
+    unsigned *order, n;
+    char *json = read_file(file);
+    JsonParser j;
+
+    if (!json) {
+        fprintf(stderr, "Unable to read %s\n", file);
+        return 1;
+    }
+    memset(&db, 0, sizeof(db));
+    db.report = report;
+    j.p = json;
+    j.end = json + strlen(json);
+    j.error = 0;
+    json_array(&j, parse_entry, &db);
+    free(json);
+    if (j.error) {
+        fprintf(stderr, "Unable to parse %s\n", file);
+        return 1;
+    }
+    if (!db.n_jobs)
+        return 0;
+    if (n_workers < 1)
+        n_workers = cpu_count();
+    if (n_workers > db.n_jobs)
+        n_workers = db.n_jobs;
+    db.n_workers = n_workers;
+    jobserver_local(n_workers);
+
+    /* probe the compiler once, rather than per job */
+    if (!base->probed) {
+        char *probe_argv[2];
+        const char *compiler = db.jobs[0].argv[0];
+        const char *base_name = compiler + strlen(compiler);
+        while (base_name > compiler && base_name[-1] != '/' && base_name[-1] != '\\')
+            base_name--;
+        probe_argv[0] = strncmp(base_name, "icl", 3) ? "cl" : "icl";
+        probe_argv[1] = NULL;
+        probe_compiler(probe_argv, &base->bits_32, &base->cl_major);
+        base->probed = 1;
+    }
+    db.base = base;
+
+    estimate_jobs(&db);
+    order = malloc(db.n_jobs * sizeof(*order));
+    db.deques = calloc(n_workers, sizeof(*db.deques));
+    workers = calloc(n_workers, sizeof(*workers));
+    threads = calloc(n_workers, sizeof(*threads));
+    if (!order || !db.deques || !workers || !threads) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    for (n = 0; n < db.n_jobs; n++)
+        order[n] = n;
+    sort_jobs = db.jobs;
+    qsort(order, db.n_jobs, sizeof(*order), compare_jobs);
+
+    /* deal round-robin, so that every deque is longest first as well */
+    for (n = 0; n < n_workers; n++) {
+        mutex_init(&db.deques[n].lock);
+        db.deques[n].jobs = malloc((db.n_jobs / n_workers + 1) * sizeof(unsigned));
+        if (!db.deques[n].jobs) {
+            fprintf(stderr, "Out of memory\n");
+            return 1;
+        }
+    }
+    for (n = 0; n < db.n_jobs; n++) {
+        JobDeque *d = &db.deques[n % n_workers];
+        d->jobs[d->tail++] = order[n];
+    }
+
+    mutex_init(&db.lock);
+    db.start = db.last_report = get_time();
+    for (n = 0; n < n_workers; n++) {
+        workers[n].db = &db;
+        workers[n].index = n;
+#ifdef _WIN32
+        threads[n] = (HANDLE) _beginthreadex(NULL, 0, compdb_worker,
+                                             &workers[n], 0, NULL);
+        if (!threads[n]) {
+#else
+        if (pthread_create(&threads[n], NULL, compdb_worker, &workers[n])) {
+#endif
+            fprintf(stderr, "Unable to create worker thread\n");
+            exit(1);
+        }
+    }
+    for (n = 0; n < n_workers; n++) {
+#ifdef _WIN32
+        WaitForSingleObject(threads[n], INFINITE);
+        CloseHandle(threads[n]);
+#else
+        pthread_join(threads[n], NULL);
+#endif
+    }
+
+    if (report)
+        write_report(&db, 1);
+    printf("%u of %u files failed, %.2fs on %u workers\n", db.n_failed,
+           db.n_jobs, get_time() - db.start, n_workers);
+
+    for (n = 0; n < n_workers; n++) {
+        mutex_destroy(&db.deques[n].lock);
+        free(db.deques[n].jobs);
+    }
+    mutex_destroy(&db.lock);
+    free(db.deques);
+    free(workers);
+    free(threads);
+    free(order);
+
+    return db.n_failed ? 1 : 0;
+}
+
+/*
+ * c99conv is run from the directory c99wrap is in, or looked up in the PATH
+ * if c99wrap was. Compile database jobs run in other directories, so the
+ * directory is made absolute.
+ */
+static char *find_conv_tool(const char *argv0)
+{
+    char dir[4096], *conv_tool, *ptr;
+
+#ifdef _WIN32
+    if (!GetModuleFileNameA(NULL, dir, sizeof(dir)) ||
+        strlen(dir) >= sizeof(dir) - 1)
+        snprintf(dir, sizeof(dir), "%s", argv0);
+#else
+    snprintf(dir, sizeof(dir), "%s", argv0);
+#endif
+    ptr = strrchr(dir, '\\');
+    if (!ptr)
+        ptr = strrchr(dir, '/');
+    if (!ptr) {
+        dir[0] = '\0';
+    } else {
+        ptr[1] = '\0';
+#ifndef _WIN32
+        if (dir[0] != '/') {
+            char *abs = realpath(dir, NULL);
+
+            if (abs) {
+                snprintf(dir, sizeof(dir), "%s/", abs);
+                free(abs);
+            }
+        }
+#endif
+    }
+
+    conv_tool = malloc(strlen(dir) + strlen(CONVERTER) + 1);
+    if (!conv_tool) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    strcpy(conv_tool, dir);
+    strcat(conv_tool, CONVERTER);
+
+    return conv_tool;
+}
+
+int main(int argc, char *argv[])
+{
+    int i = 1;
+    char *conv_tool;
+    const char *envvar = NULL;
+    const char *compdb = NULL, *report = NULL;
+    unsigned n_workers = 0;
+    WrapContext ctx;
+    int ret;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.tag = "";
+
+    conv_tool = find_conv_tool(argv[0]);
+
+    envvar = getenv("C99_TO_C89_WRAP_DEBUG_LEVEL");
+    if (envvar != NULL) {
+        DEBUG_LEVEL = strtoll(envvar, NULL, 10);
+        envvar = NULL;
+    }
+    envvar = getenv("C99_TO_C89_WRAP_SAVE_TEMPS");
+    if (envvar != NULL) {
+        ctx.keep = strtoll(envvar, NULL, 10);
+        envvar = NULL;
+    }
+    envvar = getenv("C99_TO_C89_WRAP_UPDATE");
+    if (envvar != NULL) {
+        ctx.update = strtoll(envvar, NULL, 10);
+        ctx.keep |= ctx.update;
+        envvar = NULL;
+    }
+    envvar = getenv("C99_TO_C89_WRAP_COMPACT");
+    if (envvar != NULL) {
+        ctx.compact = strtoll(envvar, NULL, 10);
+        envvar = NULL;
+    }
+    envvar = getenv("C99_TO_C89_WRAP_NO_LINE_DIRECTIVES");
+    if (envvar != NULL) {
+        DEBUG_NO_LINE_DIRECTIVES = strtoll(envvar, NULL, 10);
+        envvar = NULL;
+    }
+    /* overrides the profile chosen from the compiler version */
+    ctx.profile = getenv("C99_TO_C89_WRAP_PROFILE");
+
+    ctx.conv_tool = conv_tool;
+#ifdef _WIN32
+    InitializeCriticalSection(&spawn_lock);
+#endif
+    jobserver_init();
+    trace_init();
+
+    for (; i < argc; i++) {
+        if (!strcmp(argv[i], "-keep")) {
+            ctx.keep = 1;
+        } else if (!strcmp(argv[i], "-update")) {
+            ctx.keep = ctx.update = 1;
+        } else if (!strcmp(argv[i], "-noconv")) {
+            ctx.noconv = 1;
+        } else if (!strcmp(argv[i], "-compact")) {
+            ctx.compact = 1;
+        } else if (!strncmp(argv[i], "-profile=", 9)) {
+            ctx.profile = argv[i] + 9;
+        } else if (!strcmp(argv[i], "--compdb") && i + 1 < argc) {
+            compdb = argv[++i];
+        } else if (!strcmp(argv[i], "--report") && i + 1 < argc) {
+            report = argv[++i];
+        } else if (!strncmp(argv[i], "-j", 2)) {
+            n_workers = (unsigned) strtoul(argv[i][2] ? &argv[i][2] :
+                                           i + 1 < argc ? argv[++i] : "0",
+                                           NULL, 10);
+        } else
+            break;
+    }
+
+    if (ctx.keep && ctx.noconv) {
+        fprintf(stderr, "Using -keep with -noconv doesn't make any sense!\n "
+                        "You cannot keep intermediate files that doesn't exist.\n");
+        return 1;
+    }
+
+    if (compdb) {
+        ret = run_compdb(compdb, n_workers, report, &ctx);
+    } else if (i < argc) {
+        ret = wrap_command(argc - i, argv + i, &ctx);
+    } else {
+        fprintf(stderr, "%s [-keep|-update|-noconv] [-compact] [-profile=<name>] cl|icl <args>\n"
+                "%s [-keep|-update|-noconv] [-compact] [-profile=<name>] --compdb "
+                "compile_commands.json [-j <n>] [--report <report.json>]\n",
+                argv[0], argv[0]);
+        ret = 1;
+    }
     free(conv_tool);
-    if(response_file)
-        free(response_file);
 
-    return exit_code ? 1 : 0;
+    return ret;
 }
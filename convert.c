@@ -80,14 +80,295 @@ To use creduce (from an MSYS2 shell) for when this fails (and as it stands it wi
 */
 
 #include <assert.h>
+#include <signal.h>
 #include <stdio.h>
 #include <clang-c/Index.h>
 #include <string.h>
 #include <stdlib.h>
 #include <inttypes.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#include <direct.h>
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
 #ifdef _MSC_VER
 #define strtoll _strtoi64
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+/*
+ * libclang API accounting (build with -DC99CONV_API_STATS). Every libclang
+ * function we call goes through a wrapper that counts the calls and their
+ * time per API and calling function, and a report sorted by time is
+ * printed to stderr at exit. clang_visitChildren() is charged only for
+ * the time spent in libclang itself, not in our visitor; the cost of
+ * reading the clock is measured once and subtracted in the report. Only
+ * the visitor thread uses libclang, so the table isn't locked.
+ */
+#ifdef C99CONV_API_STATS
+typedef struct {
+    const char *api, *caller;
+    unsigned long long calls;
+    double time;
+} ApiStat;
+
+#define API_TABLE_SIZE 1024 // power of two, > the number of (api, caller) pairs
+static ApiStat api_stats[API_TABLE_SIZE];
+static unsigned n_api_stats = 0;
+static double api_overhead = 0.0; // of a wrapper around nothing, in seconds
+
+static double api_now(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+#endif
+}
+
+static int compare_api_stats(const void *a, const void *b)
+{
+    double ta = ((const ApiStat *) a)->time, tb = ((const ApiStat *) b)->time;
+
+    return ta < tb ? 1 : ta > tb ? -1 : 0;
+}
+
+/* Prints per (api, caller), then totals per caller and per api */
+static void print_api_stats(void)
+{
+    ApiStat *s, sums[API_TABLE_SIZE];
+    unsigned n, m, k, n_sums;
+    int by_caller;
+
+    s = (ApiStat *) malloc(sizeof(*s) * (n_api_stats + 1));
+    if (!s)
+        return;
+    for (n = m = 0; n < API_TABLE_SIZE; n++) {
+        if (!api_stats[n].api)
+            continue;
+        s[m] = api_stats[n];
+        s[m].time -= s[m].calls * api_overhead;
+        if (s[m].time < 0)
+            s[m].time = 0;
+        m++;
+    }
+    qsort(s, m, sizeof(*s), compare_api_stats);
+    fprintf(stderr, "libclang API calls (%.1f ns clock overhead per call "
+            "subtracted):\n%12s %12s  %-28s %s\n", api_overhead * 1e9,
+            "calls", "ms", "api", "caller");
+    for (n = 0; n < m; n++)
+        fprintf(stderr, "%12llu %12.3f  %-28s %s\n", s[n].calls,
+                s[n].time * 1000.0, s[n].api, s[n].caller);
+
+    for (by_caller = 1; by_caller >= 0; by_caller--) {
+        for (n = n_sums = 0; n < m; n++) {
+            const char *key = by_caller ? s[n].caller : s[n].api;
+            for (k = 0; k < n_sums && strcmp(by_caller ? sums[k].caller :
+                                             sums[k].api, key); k++) ;
+            if (k == n_sums) {
+                sums[n_sums++] = s[n];
+                sums[k].calls = 0;
+                sums[k].time = 0;
+            }
+            sums[k].calls += s[n].calls;
+            sums[k].time += s[n].time;
+        }
+        qsort(sums, n_sums, sizeof(*sums), compare_api_stats);
+        fprintf(stderr, "\nlibclang API calls by %s:\n",
+                by_caller ? "caller" : "api");
+        for (n = 0; n < n_sums; n++)
+            fprintf(stderr, "%12llu %12.3f  %s\n", sums[n].calls,
+                    sums[n].time * 1000.0,
+                    by_caller ? sums[n].caller : sums[n].api);
+    }
+    free(s);
+}
+
+static void api_record(const char *api, const char *caller, double t)
+{
+    uintptr_t h = ((uintptr_t) api ^ ((uintptr_t) caller * 31)) >> 3;
+    ApiStat *s;
+
+    for (;; h++) {
+        s = &api_stats[h & (API_TABLE_SIZE - 1)];
+        if (s->api == api && s->caller == caller)
+            break;
+        if (!s->api) {
+            if (!n_api_stats++) {
+                unsigned n;
+                double t0 = api_now();
+                for (n = 0; n < 1000; n++)
+                    api_now();
+                api_overhead = (api_now() - t0) / 1000.0;
+                atexit(print_api_stats);
+            }
+            if (n_api_stats >= API_TABLE_SIZE / 2) {
+                fprintf(stderr, "API stats table full\n");
+                exit(1);
+            }
+            s->api = api;
+            s->caller = caller;
+            break;
+        }
+    }
+    s->calls++;
+    s->time += t;
+}
+
+#define API_UNPAREN(...) __VA_ARGS__
+#define API_WRAP(ret, name, params, args)                               \
+static ret api_##name(const char *caller, API_UNPAREN params)           \
+{                                                                       \
+    double t0 = api_now();                                              \
+    ret res = name args;                                                \
+    api_record(#name, caller, api_now() - t0);                          \
+    return res;                                                         \
+}
+#define API_WRAP_VOID(name, params, args)                               \
+static void api_##name(const char *caller, API_UNPAREN params)          \
+{                                                                       \
+    double t0 = api_now();                                              \
+    name args;                                                          \
+    api_record(#name, caller, api_now() - t0);                          \
+}
+
+API_WRAP(const char *, clang_getCString, (CXString s), (s))
+API_WRAP_VOID(clang_disposeString, (CXString s), (s))
+API_WRAP(CXString, clang_getTokenSpelling,
+         (CXTranslationUnit tu, CXToken t), (tu, t))
+API_WRAP(CXSourceLocation, clang_getTokenLocation,
+         (CXTranslationUnit tu, CXToken t), (tu, t))
+API_WRAP(CXSourceRange, clang_getTokenExtent,
+         (CXTranslationUnit tu, CXToken t), (tu, t))
+API_WRAP_VOID(clang_tokenize,
+              (CXTranslationUnit tu, CXSourceRange r, CXToken **t, unsigned *n),
+              (tu, r, t, n))
+API_WRAP_VOID(clang_disposeTokens,
+              (CXTranslationUnit tu, CXToken *t, unsigned n), (tu, t, n))
+API_WRAP_VOID(clang_getSpellingLocation,
+              (CXSourceLocation l, CXFile *f, unsigned *line, unsigned *col,
+               unsigned *off), (l, f, line, col, off))
+API_WRAP(CXSourceRange, clang_getCursorExtent, (CXCursor c), (c))
+API_WRAP(CXSourceLocation, clang_getCursorLocation, (CXCursor c), (c))
+API_WRAP(CXString, clang_getCursorSpelling, (CXCursor c), (c))
+API_WRAP(CXString, clang_getCursorKindSpelling, (enum CXCursorKind k), (k))
+API_WRAP(unsigned, clang_hashCursor, (CXCursor c), (c))
+API_WRAP(long long, clang_getEnumConstantDeclValue, (CXCursor c), (c))
+API_WRAP(CXEvalResult, clang_Cursor_Evaluate, (CXCursor c), (c))
+API_WRAP(CXSourceLocation, clang_getRangeStart, (CXSourceRange r), (r))
+API_WRAP(CXSourceLocation, clang_getRangeEnd, (CXSourceRange r), (r))
+API_WRAP(CXSourceRange, clang_getRange,
+         (CXSourceLocation b, CXSourceLocation e), (b, e))
+API_WRAP(CXSourceLocation, clang_getLocationForOffset,
+         (CXTranslationUnit tu, CXFile f, unsigned off), (tu, f, off))
+API_WRAP(CXFile, clang_getFile,
+         (CXTranslationUnit tu, const char *name), (tu, name))
+API_WRAP(CXCursor, clang_getTranslationUnitCursor,
+         (CXTranslationUnit tu), (tu))
+#if CINDEX_VERSION_MINOR >= 30
+API_WRAP(enum CXErrorCode, clang_parseTranslationUnit2,
+         (CXIndex i, const char *f, const char *const *argv, int argc,
+          struct CXUnsavedFile *u, unsigned n_u, unsigned flags,
+          CXTranslationUnit *tu), (i, f, argv, argc, u, n_u, flags, tu))
+#else
+API_WRAP(CXTranslationUnit, clang_parseTranslationUnit,
+         (CXIndex i, const char *f, const char *const *argv, int argc,
+          struct CXUnsavedFile *u, unsigned n_u, unsigned flags),
+         (i, f, argv, argc, u, n_u, flags))
+#endif
+API_WRAP(int, clang_reparseTranslationUnit,
+         (CXTranslationUnit tu, unsigned n_u, struct CXUnsavedFile *u,
+          unsigned flags), (tu, n_u, u, flags))
+API_WRAP(CXTranslationUnit, clang_createTranslationUnit,
+         (CXIndex i, const char *f), (i, f))
+API_WRAP(int, clang_saveTranslationUnit,
+         (CXTranslationUnit tu, const char *f, unsigned flags), (tu, f, flags))
+API_WRAP_VOID(clang_disposeTranslationUnit, (CXTranslationUnit tu), (tu))
+API_WRAP(unsigned, clang_getNumDiagnostics, (CXTranslationUnit tu), (tu))
+API_WRAP(CXDiagnostic, clang_getDiagnostic,
+         (CXTranslationUnit tu, unsigned n), (tu, n))
+
+typedef struct {
+    CXCursorVisitor visitor;
+    CXClientData data;
+    double excluded; // time spent in visitor
+} ApiVisit;
+
+static enum CXChildVisitResult api_visit(CXCursor cursor, CXCursor parent,
+                                         CXClientData client_data)
+{
+    ApiVisit *v = (ApiVisit *) client_data;
+    double t0 = api_now();
+    enum CXChildVisitResult res = v->visitor(cursor, parent, v->data);
+
+    v->excluded += api_now() - t0;
+    return res;
+}
+
+static unsigned api_clang_visitChildren(const char *caller, CXCursor parent,
+                                        CXCursorVisitor visitor,
+                                        CXClientData data)
+{
+    ApiVisit v = { visitor, data, 0.0 };
+    double t0 = api_now();
+    unsigned res = clang_visitChildren(parent, api_visit, &v);
+
+    api_record("clang_visitChildren", caller, api_now() - t0 - v.excluded);
+    return res;
+}
+
+#define clang_getCString(...) api_clang_getCString(__func__, __VA_ARGS__)
+#define clang_disposeString(...) api_clang_disposeString(__func__, __VA_ARGS__)
+#define clang_getTokenSpelling(...) api_clang_getTokenSpelling(__func__, __VA_ARGS__)
+#define clang_getTokenLocation(...) api_clang_getTokenLocation(__func__, __VA_ARGS__)
+#define clang_getTokenExtent(...) api_clang_getTokenExtent(__func__, __VA_ARGS__)
+#define clang_tokenize(...) api_clang_tokenize(__func__, __VA_ARGS__)
+#define clang_disposeTokens(...) api_clang_disposeTokens(__func__, __VA_ARGS__)
+#define clang_getSpellingLocation(...) api_clang_getSpellingLocation(__func__, __VA_ARGS__)
+#define clang_getCursorExtent(...) api_clang_getCursorExtent(__func__, __VA_ARGS__)
+#define clang_getCursorLocation(...) api_clang_getCursorLocation(__func__, __VA_ARGS__)
+#define clang_getCursorSpelling(...) api_clang_getCursorSpelling(__func__, __VA_ARGS__)
+#define clang_getCursorKindSpelling(...) api_clang_getCursorKindSpelling(__func__, __VA_ARGS__)
+#define clang_hashCursor(...) api_clang_hashCursor(__func__, __VA_ARGS__)
+#define clang_getEnumConstantDeclValue(...) api_clang_getEnumConstantDeclValue(__func__, __VA_ARGS__)
+#define clang_Cursor_Evaluate(...) api_clang_Cursor_Evaluate(__func__, __VA_ARGS__)
+#define clang_getRangeStart(...) api_clang_getRangeStart(__func__, __VA_ARGS__)
+#define clang_getRangeEnd(...) api_clang_getRangeEnd(__func__, __VA_ARGS__)
+#define clang_getRange(...) api_clang_getRange(__func__, __VA_ARGS__)
+#define clang_getLocationForOffset(...) api_clang_getLocationForOffset(__func__, __VA_ARGS__)
+#define clang_getFile(...) api_clang_getFile(__func__, __VA_ARGS__)
+#define clang_getTranslationUnitCursor(...) api_clang_getTranslationUnitCursor(__func__, __VA_ARGS__)
+#define clang_parseTranslationUnit(...) api_clang_parseTranslationUnit(__func__, __VA_ARGS__)
+#define clang_parseTranslationUnit2(...) api_clang_parseTranslationUnit2(__func__, __VA_ARGS__)
+#define clang_reparseTranslationUnit(...) api_clang_reparseTranslationUnit(__func__, __VA_ARGS__)
+#define clang_createTranslationUnit(...) api_clang_createTranslationUnit(__func__, __VA_ARGS__)
+#define clang_saveTranslationUnit(...) api_clang_saveTranslationUnit(__func__, __VA_ARGS__)
+#define clang_disposeTranslationUnit(...) api_clang_disposeTranslationUnit(__func__, __VA_ARGS__)
+#define clang_getNumDiagnostics(...) api_clang_getNumDiagnostics(__func__, __VA_ARGS__)
+#define clang_getDiagnostic(...) api_clang_getDiagnostic(__func__, __VA_ARGS__)
+#define clang_visitChildren(...) api_clang_visitChildren(__func__, __VA_ARGS__)
 #endif
 
 /*
@@ -159,13 +440,29 @@ To use creduce (from an MSYS2 shell) for when this fails (and as it stands it wi
  * themselves are structs, we use {} instead of 0 as a gap filler.
  */
 
+/*
+ * Registry strings and arrays (struct, enum and typedef declarations and
+ * their members) live in a bump arena that's released as a whole at the
+ * end of a conversion. Arrays in the arena grow by doubling into a fresh
+ * allocation, so the old copy stays mapped (but stale). Type strings are
+ * hash-consed, since the same few type names are repeated across most
+ * struct members.
+ *
+ * Rather than a full CXCursor, registry entries store a CursorKey, which
+ * is sufficient to recognize a declaration we've seen before.
+ */
+typedef struct {
+    unsigned hash;
+    unsigned offset;
+    enum CXCursorKind kind; // 0 marks an unused key
+} CursorKey;
+
 typedef struct {
-    char *type;
+    const char *type; // interned
     unsigned struct_decl_idx;
     char *name;
     unsigned n_ptrs; // 0 if not a pointer
     unsigned array_depth; // 0 if no array
-    CXCursor cursor;
 } StructMember;
 
 typedef struct {
@@ -173,7 +470,7 @@ typedef struct {
     unsigned n_entries;
     unsigned n_allocated_entries;
     char *name;
-    CXCursor cursor;
+    CursorKey key;
     int is_union;
 } StructDeclaration;
 static StructDeclaration *structs = NULL;
@@ -182,8 +479,7 @@ static unsigned n_allocated_structs = 0;
 
 typedef struct {
     char *name;
-    int value;
-    CXCursor cursor;
+    int64_t value;
 } EnumMember;
 
 typedef struct {
@@ -191,7 +487,7 @@ typedef struct {
     unsigned n_entries;
     unsigned n_allocated_entries;
     char *name;
-    CXCursor cursor;
+    CursorKey key;
 } EnumDeclaration;
 static EnumDeclaration *enums = NULL;
 static unsigned n_enums = 0;
@@ -201,16 +497,19 @@ static unsigned n_allocated_enums = 0;
  * in large part because Libav doesn't use those in combination with
  * typedefs. */
 typedef struct {
-    char *proxy;
+    const char *proxy; // interned
     char *name;
     unsigned struct_decl_idx;
     unsigned enum_decl_idx;
-    CXCursor cursor;
 } TypedefDeclaration;
 static TypedefDeclaration *typedefs = NULL;
 static unsigned n_typedefs = 0;
 static unsigned n_allocated_typedefs = 0;
 
+// set while visiting declarations whose registry entries were loaded from
+// a snapshot (see load_registry_snapshot())
+static int registry_frozen = 0;
+
 enum StructArrayType {
     TYPE_IRRELEVANT = 0,
     TYPE_STRUCT     = 1,
@@ -221,6 +520,7 @@ typedef struct {
     struct {
         unsigned start, end;
     } value_offset, expression_offset;
+    double float_value; // see evaluate_union_float_values()
 } StructArrayItem;
 
 typedef struct {
@@ -237,25 +537,104 @@ typedef struct {
     int convert_to_assignment;
     char *name;
 } StructArrayList;
-static StructArrayList *struct_array_lists = NULL;
-static unsigned n_struct_array_lists = 0;
-static unsigned n_allocated_struct_array_lists = 0;
+
+/*
+ * The struct/array, compound literal and scope lists describe the rewrites
+ * for the declaration(s) being converted. They're thread-local, so that in
+ * threaded mode the visitor can fill lists for one top-level declaration
+ * while emitter threads print earlier ones (see DeclLists).
+ */
+static THREAD_LOCAL StructArrayList *struct_array_lists = NULL;
+static THREAD_LOCAL unsigned n_struct_array_lists = 0;
+static THREAD_LOCAL unsigned n_allocated_struct_array_lists = 0;
 
 typedef struct {
     int end;
     int n_scopes;
 } EndScope;
-static EndScope *end_scopes = NULL;
-static unsigned n_end_scopes = 0;
-static unsigned n_allocated_end_scopes = 0;
+static THREAD_LOCAL EndScope *end_scopes = NULL;
+static THREAD_LOCAL unsigned n_end_scopes = 0;
+static THREAD_LOCAL unsigned n_allocated_end_scopes = 0;
+
+/*
+ * Per-file statistics (-stats=, C99_TO_C89_CONV_STATS), written as one
+ * JSON object per converted file, so that they can be collected across
+ * many builds. Registry time is part of visit time, and reorder time is
+ * part of emit time. Emitter threads add up their own printing costs in
+ * emit_stats, which are merged into stats once a chunk has been printed.
+ */
+enum StatsPhase {
+    PHASE_PARSE,
+    PHASE_TOKENIZE,
+    PHASE_VISIT,
+    PHASE_REGISTRY,
+    PHASE_REORDER,
+    PHASE_EMIT,
+    N_PHASES,
+};
+static const char *phase_names[N_PHASES] = {
+    "parse", "tokenize", "visit", "registry", "reorder", "emit",
+};
+static const char *cl_type_names[] = { // indexed by enum CLType
+    "unknown", "omit_cast", "temp_assign", "const_decl", "new_context",
+    "loop_context",
+};
+#define N_CL_TYPES (sizeof(cl_type_names) / sizeof(cl_type_names[0]))
+
+typedef struct {
+    double reorder, emit;
+    unsigned gap_fillers;
+} EmitStats;
+
+static struct {
+    int enabled;
+    double time[N_PHASES];
+    unsigned registry_depth;
+    unsigned tokens, cursors;
+    unsigned structs, enums, typedefs;
+    unsigned comp_literals[N_CL_TYPES];
+    unsigned struct_lists, array_lists, end_scopes, gap_fillers;
+    size_t bytes_in, bytes_out;
+} stats;
+static THREAD_LOCAL EmitStats emit_stats;
 
 static FILE *out;
 
 static CXTranslationUnit TU;
 
+/*
+ * Rewrite classes. A target compiler profile (-profile=) turns off the
+ * ones that compiler already accepts; the visitor then doesn't analyze
+ * those constructs at all, and they're printed as they are.
+ */
+enum {
+    REWRITE_COMPOUND_LITERALS = 1 << 0,
+    REWRITE_DESIGNATED_INITS  = 1 << 1, // in compound literals, needs the above
+    REWRITE_MIXED_DECLS       = 1 << 2, // declarations after statements
+    REWRITE_LOOP_DECLS        = 1 << 3, // for (int i = 0; ...)
+    REWRITE_UNION_INITS       = 1 << 4, // designated non-first union members,
+                                        // as assignments (in functions)
+    REWRITE_ALL               = (1 << 5) - 1,
+};
+
+typedef struct {
+    const char *name;
+    unsigned rewrites;
+} Profile;
+
+static const Profile profiles[] = {
+    { "vs2008", REWRITE_ALL },
+    // VS2013 (cl 18) accepts designated initializers and declarations
+    // anywhere, but its compound literal support is incomplete
+    { "vs2013", REWRITE_COMPOUND_LITERALS },
+    { "vs2015", 0 },
+};
+
+static unsigned rewrites = REWRITE_ALL;
+
 /* 0 is no debugging */
 /* 1 prints clean-up stuff */
-/* 2 also prints a huge amount of token parsing info */
+/* 2 also prints the lists built while parsing (cursors are in the trace) */
 /* 3 also prints info about some of the Anaconda Distribution modifications/bugfixes */
 static int DEBUG_LEVEL = 0;
 
@@ -283,6 +662,283 @@ int print_log(const char* format, ...) {
     if (DEBUG_LEVEL != 0) \
         printf(__VA_ARGS__)
 
+/*
+ * Binary trace of what the visitor saw and decided, cheap enough to leave
+ * on for production-sized files: each event is a fixed-size record in an
+ * in-memory ring of the last TRACE_RECORDS ones. With C99_TO_C89_CONV_TRACE
+ * set to a file name, the ring is written there when c99conv crashes or
+ * fails an assert, or on SIGUSR1, and c99conv -decodetrace prints it.
+ */
+enum TraceEvent {
+    TRACE_CONVERT = 1,  // a: number of the input in this run
+    TRACE_CURSOR,       // kind: cursor, a: offset, b: tokens, c: parent kind
+    TRACE_TOKEN,        // a: offset, b: line, c: column
+    TRACE_COMP_LITERAL, // a: list, b: cast offset
+    TRACE_INIT_LIST,    // kind: TraceInitFrom, a: list, b: offset, c: struct
+    TRACE_INIT_ENTRY,   // kind: list type, a: list, b: offset, c: index
+    TRACE_FILLER,       // a: list, b: offset, c: index
+    TRACE_ASSIGNMENT,   // a: list converted to assignments
+    TRACE_END_SCOPE,    // a: offset, b: scopes
+    TRACE_CHUNK,        // a: start offset, b: end offset, c: tokens
+    N_TRACE_EVENTS
+};
+
+enum TraceInitFrom {
+    TRACE_FROM_VAR_DECL,
+    TRACE_FROM_COMP_LITERAL,
+    TRACE_FROM_ENCLOSING_LIST,
+};
+
+typedef struct TraceRecord {
+    uint16_t event, kind;
+    uint32_t a, b, c;
+} TraceRecord;
+
+typedef struct TraceHeader {
+    char magic[8];       // "C99TRACE"
+    uint32_t version, record_size;
+    uint64_t head;       // events ever recorded, the last n_records follow
+    uint32_t n_records, reserved;
+} TraceHeader;
+
+#define TRACE_RECORDS (1 << 18) // power of two
+static TraceRecord *trace_ring = NULL;
+static uint64_t trace_head = 0;
+static char trace_path[4096];
+
+// only the visitor (main) thread records events
+#define trace(ev, k, x, y, z) \
+    do { \
+        if (trace_ring) { \
+            TraceRecord *r_ = &trace_ring[trace_head++ & (TRACE_RECORDS - 1)]; \
+            r_->event = (ev); \
+            r_->kind = (uint16_t) (k); \
+            r_->a = (x); \
+            r_->b = (y); \
+            r_->c = (z); \
+        } \
+    } while (0)
+
+/* Writes the ring to trace_path, only using async-signal-safe calls */
+static void trace_dump(void)
+{
+    TraceHeader h;
+    uint64_t head = trace_head;
+    unsigned first = (unsigned) (head & (TRACE_RECORDS - 1));
+    int fd, res;
+
+#ifdef _WIN32
+    fd = _open(trace_path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+               _S_IREAD | _S_IWRITE);
+#define write(fd, buf, len) _write(fd, buf, (unsigned) (len))
+#define close _close
+#else
+    fd = open(trace_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+    if (fd < 0)
+        return;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "C99TRACE", 8);
+    h.version = 1;
+    h.record_size = sizeof(TraceRecord);
+    h.head = head;
+    h.n_records = head < TRACE_RECORDS ? (uint32_t) head : TRACE_RECORDS;
+    res = write(fd, &h, sizeof(h)) == sizeof(h);
+    if (res && head >= TRACE_RECORDS)
+        res = write(fd, &trace_ring[first],
+                    (TRACE_RECORDS - first) * sizeof(TraceRecord)) > 0;
+    if (res && first)
+        write(fd, trace_ring, first * sizeof(TraceRecord));
+    close(fd);
+#ifdef _WIN32
+#undef write
+#undef close
+#endif
+}
+
+static void trace_signal(int sig)
+{
+    trace_dump();
+#ifdef SIGUSR1
+    if (sig == SIGUSR1)
+        return;
+#endif
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+static void trace_init(void)
+{
+    const char *path = getenv("C99_TO_C89_CONV_TRACE");
+
+    if (!path || !path[0] || strlen(path) >= sizeof(trace_path))
+        return;
+    trace_ring = (TraceRecord *) calloc(TRACE_RECORDS, sizeof(*trace_ring));
+    if (!trace_ring) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    strcpy(trace_path, path);
+    signal(SIGSEGV, trace_signal);
+    signal(SIGABRT, trace_signal);
+    signal(SIGFPE, trace_signal);
+    signal(SIGILL, trace_signal);
+#ifdef SIGBUS
+    signal(SIGBUS, trace_signal);
+#endif
+#ifdef SIGUSR1
+    signal(SIGUSR1, trace_signal);
+#endif
+}
+
+typedef struct ArenaBlock ArenaBlock;
+struct ArenaBlock {
+    ArenaBlock *next;
+    size_t size, used;
+};
+#define ARENA_ALIGN 16
+#define ARENA_HEADER_SIZE \
+    ((sizeof(ArenaBlock) + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1))
+#define ARENA_BLOCK_SIZE (1024 * 1024)
+static ArenaBlock *arena = NULL;
+
+static const char **interned_strings = NULL;
+static unsigned n_interned_strings = 0;
+static unsigned n_allocated_interned_strings = 0;
+
+static void *arena_alloc(size_t size)
+{
+    ArenaBlock *b = arena;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1);
+    if (!b || b->size - b->used < size) {
+        size_t block_size = size > ARENA_BLOCK_SIZE / 4 ? size : ARENA_BLOCK_SIZE;
+
+        b = (ArenaBlock *) malloc(ARENA_HEADER_SIZE + block_size);
+        if (!b) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        b->size = block_size;
+        b->used = 0;
+        if (block_size != ARENA_BLOCK_SIZE && arena) {
+            // oversized: keep allocating from the current block
+            b->next = arena->next;
+            arena->next = b;
+        } else {
+            b->next = arena;
+            arena = b;
+        }
+    }
+    b->used += size;
+
+    return (char *) b + ARENA_HEADER_SIZE + b->used - size;
+}
+
+static char *arena_strdup(const char *str)
+{
+    size_t len = strlen(str) + 1;
+
+    return (char *) memcpy(arena_alloc(len), str, len);
+}
+
+/* Returns a copy of the n_used elements of mem (of the given element size)
+ * in an allocation with twice the capacity. */
+static void *arena_grow_array(const void *mem, unsigned n_used,
+                              unsigned *n_allocated, size_t size)
+{
+    unsigned num = *n_allocated ? *n_allocated * 2 : 16;
+    void *new_mem = arena_alloc(size * num);
+
+    if (n_used)
+        memcpy(new_mem, mem, size * n_used);
+    *n_allocated = num;
+
+    return new_mem;
+}
+
+static void arena_release(void)
+{
+    ArenaBlock *b, *next;
+
+    for (b = arena; b; b = next) {
+        next = b->next;
+        free(b);
+    }
+    arena = NULL;
+    interned_strings = NULL;
+    n_interned_strings = n_allocated_interned_strings = 0;
+}
+
+static unsigned hash_string(const char *str)
+{
+    unsigned hash = 2166136261U; // FNV-1a
+
+    while (*str)
+        hash = (hash ^ (unsigned char) *str++) * 16777619U;
+
+    return hash;
+}
+
+static const char **find_interned_string(const char *str)
+{
+    unsigned mask = n_allocated_interned_strings - 1;
+    unsigned n = hash_string(str) & mask;
+
+    while (interned_strings[n] && strcmp(interned_strings[n], str))
+        n = (n + 1) & mask;
+
+    return &interned_strings[n];
+}
+
+static const char *intern_string(const char *str)
+{
+    const char **entry;
+
+    if (n_interned_strings * 4 >= n_allocated_interned_strings * 3) {
+        const char **old = interned_strings;
+        unsigned n, n_old = n_allocated_interned_strings;
+
+        n_allocated_interned_strings = n_old ? n_old * 2 : 256;
+        interned_strings = (const char **)
+            arena_alloc(sizeof(*interned_strings) * n_allocated_interned_strings);
+        memset(interned_strings, 0,
+               sizeof(*interned_strings) * n_allocated_interned_strings);
+        for (n = 0; n < n_old; n++) {
+            if (old[n])
+                *find_interned_string(old[n]) = old[n];
+        }
+    }
+
+    entry = find_interned_string(str);
+    if (!*entry) {
+        *entry = arena_strdup(str);
+        n_interned_strings++;
+    }
+
+    return *entry;
+}
+
+static CursorKey cursor_key(CXCursor cursor)
+{
+    CursorKey key;
+    CXFile file;
+    unsigned line, col;
+
+    key.hash = clang_hashCursor(cursor);
+    key.kind = cursor.kind;
+    clang_getSpellingLocation(clang_getCursorLocation(cursor),
+                              &file, &line, &col, &key.offset);
+
+    return key;
+}
+
+static int cursor_keys_equal(CursorKey a, CursorKey b)
+{
+    return a.hash == b.hash && a.offset == b.offset && a.kind == b.kind;
+}
+
+
 static unsigned find_token_index(CXToken *tokens, unsigned n_tokens,
                                  const char *str)
 {
@@ -313,11 +969,13 @@ static char *concat_name(CXToken *tokens, unsigned int from, unsigned to)
         clang_disposeString(tstr);
     }
 
-    str = (char *) malloc(cnt);
+    // the range is empty for e.g. 'typedef int x;'
+    str = (char *) malloc(cnt + 1);
     if (!str) {
         fprintf(stderr, "Out of memory\n");
         exit(1);
     }
+    str[0] = 0;
 
     for (cnt = 0, n = from; n <= to; n++) {
         CXString tstr = clang_getTokenSpelling(TU, tokens[n]);
@@ -398,22 +1056,13 @@ static enum CXChildVisitResult fill_struct_members(CXCursor cursor,
 
         clang_tokenize(TU, range, &tokens, &n_tokens);
 
-        if (decl->n_entries == decl->n_allocated_entries) {
-            unsigned num = decl->n_allocated_entries + 16;
-            void *mem = realloc(decl->entries,
-                                sizeof(*decl->entries) * num);
-            if (!mem) {
-                fprintf(stderr,
-                        "Ran out of memory while declaring field %s in %s\n",
-                        str, decl->name);
-                exit(1);
-            }
-            decl->entries = (StructMember *) mem;
-            decl->n_allocated_entries = num;
-        }
+        if (decl->n_entries == decl->n_allocated_entries)
+            decl->entries = (StructMember *)
+                arena_grow_array(decl->entries, decl->n_entries,
+                                 &decl->n_allocated_entries,
+                                 sizeof(*decl->entries));
 
-        decl->entries[n].name = strdup(str);
-        decl->entries[n].cursor = cursor;
+        decl->entries[n].name = arena_strdup(str);
         decl->n_entries++;
 
         idx = find_token_index(tokens, n_tokens, str);
@@ -448,9 +1097,11 @@ static enum CXChildVisitResult fill_struct_members(CXCursor cursor,
             CXString tstr = clang_getTokenSpelling(TU, tokens[im1]);
             const char *cstr = clang_getCString(tstr);
             if (!strcmp(cstr, ",")) {
-                decl->entries[n].type = strdup(decl->entries[n - 1].type);
+                decl->entries[n].type = decl->entries[n - 1].type;
             } else {
-                decl->entries[n].type = concat_name(tokens, 0, im1);
+                char *type = concat_name(tokens, 0, im1);
+                decl->entries[n].type = intern_string(type);
+                free(type);
             }
             clang_disposeString(tstr);
         } while (0);
@@ -458,6 +1109,8 @@ static enum CXChildVisitResult fill_struct_members(CXCursor cursor,
         memset(&td, 0, sizeof(td));
         td.struct_decl_idx = (unsigned) -1;
         clang_visitChildren(cursor, find_anon_struct, &td);
+        // find_anon_struct() may have registered a struct, moving structs[]
+        decl = &structs[decl_idx];
         decl->entries[n].struct_decl_idx = td.struct_decl_idx;
 
         // FIXME it's not hard to find the struct name (either because
@@ -492,14 +1145,15 @@ static void register_struct(const char *str, CXCursor cursor,
 {
     uintptr_t n;
     StructDeclaration *decl;
+    CursorKey key = cursor_key(cursor);
 
     for (n = 0; n < n_structs; n++) {
         if ((str[0] != 0 && !strcmp(structs[n].name, str)) ||
-            !memcmp(&cursor, &structs[n].cursor, sizeof(cursor))) {
+            (!registry_frozen && cursor_keys_equal(key, structs[n].key))) {
             /* already exists */
             if (decl_ptr)
                 decl_ptr->struct_decl_idx = n;
-            if (structs[n].n_entries == 0) {
+            if (structs[n].n_entries == 0 && !registry_frozen) {
                 // Fill in structs that were defined (empty) earlier, i.e.
                 // 'struct AVFilterPad;', followed by the full declaration
                 // 'struct AVFilterPad { ... };'
@@ -509,22 +1163,17 @@ static void register_struct(const char *str, CXCursor cursor,
         }
     }
 
-    if (n_structs == n_allocated_structs) {
-        unsigned num = n_allocated_structs + 16;
-        void *mem = realloc(structs, sizeof(*structs) * num);
-        if (!mem) {
-            fprintf(stderr, "Out of memory while registering struct %s\n", str);
-            exit(1);
-        }
-        structs = (StructDeclaration *) mem;
-        n_allocated_structs = num;
-    }
+    if (n_structs == n_allocated_structs)
+        structs = (StructDeclaration *)
+            arena_grow_array(structs, n_structs, &n_allocated_structs,
+                             sizeof(*structs));
 
     if (decl_ptr)
         decl_ptr->struct_decl_idx = n_structs;
     decl = &structs[n_structs++];
-    decl->name = strdup(str);
-    decl->cursor = cursor;
+    stats.structs++;
+    decl->name = arena_strdup(str);
+    decl->key = key;
     decl->n_entries = 0;
     decl->n_allocated_entries = 0;
     decl->entries = NULL;
@@ -533,47 +1182,7 @@ static void register_struct(const char *str, CXCursor cursor,
     clang_visitChildren(cursor, fill_struct_members, (void *)(uintptr_t)(n_structs - 1));
 }
 
-static int arithmetic_expression(int val1, const char *expr, int val2)
-{
-    assert(expr[1] == 0 || expr[2] == 0);
-
-    if (expr[1] == 0) {
-        switch (expr[0]) {
-        case '^': return val1 ^ val2;
-        case '|': return val1 | val2;
-        case '&': return val1 & val2;
-        case '+': return val1 + val2;
-        case '-': return val1 - val2;
-        case '*': return val1 * val2;
-        case '/': return val1 / val2;
-        case '%': return val1 % val2;
-        default:
-            fprintf(stderr, "Arithmetic expression '%c' not handled\n",
-                    expr[0]);
-            exit(1);
-        }
-    } else {
-#define TWOCHARCODE(a, b) ((a << 8) | b)
-#define TWOCHARTAG(expr) (TWOCHARCODE(expr[0], expr[1]))
-        switch (TWOCHARTAG(expr)) {
-        case TWOCHARCODE('<', '='): return val1 <= val2;
-        case TWOCHARCODE('>', '='): return val1 >= val2;
-        case TWOCHARCODE('!', '='): return val1 != val2;
-        case TWOCHARCODE('=', '='): return val1 == val2;
-        case TWOCHARCODE('<', '<'): return val1 << val2;
-        case TWOCHARCODE('>', '>'): return val1 >> val2;
-        default:
-            fprintf(stderr, "Arithmetic expression '%s' not handled\n",
-                    expr);
-            exit(1);
-        }
-    }
-
-    fprintf(stderr, "Unknown arithmetic expression %s\n", expr);
-    exit(1);
-}
-
-static int find_enum_value(const char *str)
+static int64_t find_enum_value(const char *str)
 {
     unsigned n, m;
 
@@ -588,148 +1197,558 @@ static int find_enum_value(const char *str)
     exit(1);
 }
 
-typedef struct FillEnumMemberCache {
-    int n[3];
-    char *op;
-} FillEnumMemberCache;
+/*
+ * Constant expression evaluation, used for enum values, array designator
+ * indices ('[X] = val') and floating point values assigned to unions.
+ *
+ * Integer constants belonging to a cursor are evaluated by libclang where
+ * possible (clang_getEnumConstantDeclValue() for enum constants and
+ * clang_Cursor_Evaluate() for other expressions), and otherwise by the
+ * small interpreter below, which runs over the spellings of the tokens of
+ * the expression. Results are memoized per cursor, so that long chains
+ * like 'A = B + 1' in enum-heavy headers are only evaluated once. All
+ * integer arithmetic uses 64-bit semantics.
+ */
+#if defined(CINDEX_VERSION_MINOR) && \
+    (CINDEX_VERSION_MAJOR > 0 || CINDEX_VERSION_MINOR >= 35)
+#define HAVE_CURSOR_EVALUATE 1
+#endif
+#if defined(CINDEX_VERSION_MINOR) && \
+    (CINDEX_VERSION_MAJOR > 0 || CINDEX_VERSION_MINOR >= 43)
+#define HAVE_EVAL_RESULT_LONGLONG 1
+#endif
 
-static enum CXChildVisitResult fill_enum_value(CXCursor cursor,
-                                               CXCursor parent,
-                                               CXClientData client_data)
-{
-    FillEnumMemberCache *cache = (FillEnumMemberCache *) client_data;
-    CXToken *tokens = 0;
-    unsigned int n_tokens = 0;
-    CXSourceRange range = clang_getCursorExtent(cursor);
+typedef struct {
+    int is_float;
+    int64_t i;
+    double d;
+} ConstantValue;
 
-    clang_tokenize(TU, range, &tokens, &n_tokens);
-    if (parent.kind == CXCursor_BinaryOperator && cache->n[0] == 0) {
-        CXString str = clang_getTokenSpelling(TU, tokens[n_tokens - 1]);
-        cache->op = strdup(clang_getCString(str));
-        clang_disposeString(str);
-    }
+typedef struct {
+    const char **spellings;
+    unsigned n, last;
+    // > 0 while parsing an operand that doesn't affect the result
+    unsigned skip;
+} ConstantParser;
 
-    switch (cursor.kind) {
-    case CXCursor_UnaryOperator: {
-        CXString tsp = clang_getTokenSpelling(TU, tokens[0]);
-        const char *str = clang_getCString(tsp);
-        clang_visitChildren(cursor, fill_enum_value, client_data);
-        assert(str[1] == 0 && (str[0] == '+' || str[0] == '-' || str[0] == '~'));
-        assert(cache->n[0] == 1);
-        if (str[0] == '-') {
-            cache->n[1] = -cache->n[1];
-        } else if (str[0] == '~') {
-            cache->n[1] = ~cache->n[1];
-        }
-        clang_disposeString(tsp);
-        break;
-    }
-    case CXCursor_BinaryOperator: {
-        FillEnumMemberCache cache2;
-
-        memset(&cache2, 0, sizeof(cache2));
-        assert(n_tokens >= 4);
-        clang_visitChildren(cursor, fill_enum_value, &cache2);
-        assert(cache2.n[0] == 2);
-        assert(cache2.op != NULL);
-        cache->n[++cache->n[0]] = arithmetic_expression(cache2.n[1],
-                                                        cache2.op,
-                                                        cache2.n[2]);
-        free(cache2.op);
-        break;
-    }
-    case CXCursor_IntegerLiteral: {
-        CXString tsp;
-        const char *str;
-        char *end;
-
-        assert(n_tokens == 2);
-        tsp = clang_getTokenSpelling(TU, tokens[0]);
-        str = clang_getCString(tsp);
-        cache->n[++cache->n[0]] = strtol(str, &end, 0);
-        assert(end - str == strlen(str) ||
-               (end - str == strlen(str) - 1 && // str may have a suffix like 'U' that strtol doesn't consume
-                (*end == 'U' || *end == 'u')));
-        clang_disposeString(tsp);
-        break;
-    }
-    case CXCursor_DeclRefExpr: {
-        CXString tsp;
+typedef struct {
+    CursorKey key;
+    int64_t value;
+} ConstantCacheEntry;
+static ConstantCacheEntry *constant_cache = NULL;
+static unsigned n_constant_cache = 0;
+static unsigned n_allocated_constant_cache = 0;
 
-        assert(n_tokens == 2);
-        tsp = clang_getTokenSpelling(TU, tokens[0]);
-        cache->n[++cache->n[0]] = find_enum_value(clang_getCString(tsp));
-        clang_disposeString(tsp);
-        break;
-    }
-    case CXCursor_CharacterLiteral: {
-        CXString spelling;
-        const char *str;
+static ConstantValue eval_conditional(ConstantParser *p);
 
-        assert(n_tokens == 2);
-        spelling = clang_getTokenSpelling(TU, tokens[0]);
-        str = clang_getCString(spelling);
-        assert(strlen(str) == 3 && str[0] == '\'' && str[2] == '\'');
-        cache->n[++cache->n[0]] = str[1];
-        clang_disposeString(spelling);
-        break;
-    }
-    case CXCursor_ParenExpr:
-        clang_visitChildren(cursor, fill_enum_value, client_data);
-        break;
-    default:
-        break;
-    }
+static const char *peek_constant_token(ConstantParser *p)
+{
+    return p->n <= p->last ? p->spellings[p->n] : "";
+}
 
-    clang_disposeTokens(TU, tokens, n_tokens);
+static double constant_as_double(ConstantValue v)
+{
+    return v.is_float ? v.d : (double) v.i;
+}
 
-    return CXChildVisit_Continue;
+static int64_t constant_as_int(ConstantValue v)
+{
+    return v.is_float ? (int64_t) v.d : v.i;
 }
 
-static enum CXChildVisitResult fill_enum_members(CXCursor cursor,
-                                                 CXCursor parent,
-                                                 CXClientData client_data)
+static ConstantValue int_constant(int64_t i)
 {
-    EnumDeclaration *decl = (EnumDeclaration *) client_data;
+    ConstantValue v;
 
-    if (cursor.kind == CXCursor_EnumConstantDecl) {
-        CXString cstr = clang_getCursorSpelling(cursor);
-        const char *str = clang_getCString(cstr);
-        unsigned n = decl->n_entries;
-        FillEnumMemberCache cache;
+    v.is_float = 0;
+    v.i = i;
+    v.d = 0.0;
 
-        memset(&cache, 0, sizeof(cache));
-        if (decl->n_entries == decl->n_allocated_entries) {
-            unsigned num = decl->n_allocated_entries + 16;
-            void *mem = realloc(decl->entries,
-                                sizeof(*decl->entries) * num);
-            if (!mem) {
-                fprintf(stderr,
-                        "Ran out of memory while declaring field %s in %s\n",
-                        str, decl->name);
-                exit(1);
-            }
-            decl->entries = (EnumMember *) mem;
-            decl->n_allocated_entries = num;
-        }
-
-        decl->entries[n].name = strdup(str);
-        decl->entries[n].cursor = cursor;
-        clang_visitChildren(cursor, fill_enum_value, &cache);
-        assert(cache.n[0] <= 1);
-        if (cache.n[0] == 1) {
-            decl->entries[n].value = cache.n[1];
-        } else if (n == 0) {
-            decl->entries[n].value = 0;
-        } else {
-            decl->entries[n].value = decl->entries[n - 1].value + 1;
-        }
-        decl->n_entries++;
+    return v;
+}
 
-        clang_disposeString(cstr);
-    }
+static ConstantValue float_constant(double d)
+{
+    ConstantValue v;
 
-    return CXChildVisit_Continue;
+    v.is_float = 1;
+    v.i = 0;
+    v.d = d;
+
+    return v;
+}
+
+static int is_builtin_type_keyword(const char *str)
+{
+    static const char *keywords[] = {
+        "char", "short", "int", "long", "signed", "unsigned", "float",
+        "double", "const", "volatile", "_Bool", "__int64", NULL
+    };
+    unsigned n;
+
+    for (n = 0; keywords[n]; n++) {
+        if (!strcmp(str, keywords[n]))
+            return 1;
+    }
+
+    return 0;
+}
+
+static ConstantValue cast_constant(ConstantParser *p, unsigned first,
+                                   unsigned last, ConstantValue v)
+{
+    unsigned n, bits = 32, is_unsigned = 0, n_long = 0, is_float = 0;
+
+    for (n = first; n <= last; n++) {
+        const char *str = p->spellings[n];
+
+        if (!strcmp(str, "char"))
+            bits = 8;
+        else if (!strcmp(str, "short"))
+            bits = 16;
+        else if (!strcmp(str, "long"))
+            n_long++;
+        else if (!strcmp(str, "__int64"))
+            n_long = 2;
+        else if (!strcmp(str, "_Bool"))
+            bits = 1;
+        else if (!strcmp(str, "unsigned"))
+            is_unsigned = 1;
+        else if (!strcmp(str, "float") || !strcmp(str, "double"))
+            is_float = 1;
+    }
+
+    if (is_float)
+        return float_constant(constant_as_double(v));
+    // long is 32 bits on all (win32/win64) targets we convert for
+    if (n_long == 2)
+        bits = 64;
+
+    if (bits == 1)
+        return int_constant(constant_as_double(v) != 0.0);
+    if (bits < 64) {
+        uint64_t mask = (UINT64_C(1) << bits) - 1;
+        uint64_t u = (uint64_t) constant_as_int(v) & mask;
+        if (!is_unsigned && (u >> (bits - 1)))
+            u |= ~mask;
+        return int_constant((int64_t) u);
+    }
+
+    return int_constant(constant_as_int(v));
+}
+
+static ConstantValue parse_constant_literal(const char *str)
+{
+    char *end;
+
+    if (str[0] == '\'' || (str[0] == 'L' && str[1] == '\'')) {
+        const char *c = str[0] == 'L' ? str + 2 : str + 1;
+
+        if (c[0] != '\\')
+            return int_constant((unsigned char) c[0]);
+        switch (c[1]) {
+        case 'n':  return int_constant('\n');
+        case 't':  return int_constant('\t');
+        case 'r':  return int_constant('\r');
+        case 'a':  return int_constant('\a');
+        case 'b':  return int_constant('\b');
+        case 'f':  return int_constant('\f');
+        case 'v':  return int_constant('\v');
+        case 'x':  return int_constant(strtol(c + 2, NULL, 16));
+        case '\\': return int_constant('\\');
+        case '\'': return int_constant('\'');
+        case '"':  return int_constant('"');
+        case '?':  return int_constant('?');
+        default:   return int_constant(strtol(c + 1, NULL, 8));
+        }
+    } else if ((str[0] >= '0' && str[0] <= '9') || str[0] == '.') {
+        int is_hex = str[0] == '0' && (str[1] == 'x' || str[1] == 'X');
+        ConstantValue v;
+
+        if (strchr(str, '.') || (!is_hex && strpbrk(str, "eEfF")) ||
+            (is_hex && strpbrk(str, "pP"))) {
+            v = float_constant(strtod(str, &end));
+            // Handle a possible f or l suffix for float constants
+            while (*end == 'f' || *end == 'F' || *end == 'l' || *end == 'L')
+                end++;
+        } else {
+            v = int_constant((int64_t) strtoull(str, &end, 0));
+            // Handle possible u, l, ll and i64 suffixes for int constants
+            while (*end == 'u' || *end == 'U' || *end == 'l' || *end == 'L')
+                end++;
+            if (!strcmp(end, "i64") || !strcmp(end, "I64"))
+                end += 3;
+        }
+        if (*end == '\0')
+            return v;
+    } else if ((str[0] >= 'a' && str[0] <= 'z') ||
+               (str[0] >= 'A' && str[0] <= 'Z') || str[0] == '_') {
+        return int_constant(find_enum_value(str));
+    }
+
+    fprintf(stderr, "Unable to parse %s as expression primary\n", str);
+    exit(1);
+}
+
+static ConstantValue eval_unary(ConstantParser *p)
+{
+    const char *str = peek_constant_token(p);
+
+    if (p->n > p->last) {
+        fprintf(stderr, "Unable to parse an expression primary, no more tokens\n");
+        exit(1);
+    }
+
+    if (!strcmp(str, "-") || !strcmp(str, "+") ||
+        !strcmp(str, "~") || !strcmp(str, "!")) {
+        ConstantValue v;
+
+        p->n++;
+        v = eval_unary(p);
+        switch (str[0]) {
+        case '-':
+            return v.is_float ? float_constant(-v.d) :
+                                int_constant((int64_t) (0 - (uint64_t) v.i));
+        case '~':
+            return int_constant(~constant_as_int(v));
+        case '!':
+            return int_constant(constant_as_double(v) == 0.0);
+        default:
+            return v;
+        }
+    } else if (!strcmp(str, "(")) {
+        unsigned n, first = ++p->n;
+        ConstantValue v;
+
+        // casts to builtin types, e.g. the double casts in DBL_MAX in
+        // certain glibc versions
+        for (n = first; n <= p->last && is_builtin_type_keyword(p->spellings[n]); n++) ;
+        if (n > first && n <= p->last && !strcmp(p->spellings[n], ")")) {
+            p->n = n + 1;
+            return cast_constant(p, first, n - 1, eval_unary(p));
+        }
+
+        v = eval_conditional(p);
+        if (strcmp(peek_constant_token(p), ")")) {
+            fprintf(stderr, "No right parenthesis found\n");
+            exit(1);
+        }
+        p->n++;
+        return v;
+    }
+
+    p->n++;
+    return parse_constant_literal(str);
+}
+
+static unsigned binary_precedence(const char *op)
+{
+    static const struct {
+        const char *op;
+        unsigned prec;
+    } ops[] = {
+        { "*", 10 }, { "/", 10 }, { "%", 10 },
+        { "+", 9 }, { "-", 9 },
+        { "<<", 8 }, { ">>", 8 },
+        { "<", 7 }, { ">", 7 }, { "<=", 7 }, { ">=", 7 },
+        { "==", 6 }, { "!=", 6 },
+        { "&", 5 }, { "^", 4 }, { "|", 3 }, { "&&", 2 }, { "||", 1 },
+        { NULL, 0 }
+    };
+    unsigned n;
+
+    for (n = 0; ops[n].op; n++) {
+        if (!strcmp(op, ops[n].op))
+            return ops[n].prec;
+    }
+
+    return 0;
+}
+
+static ConstantValue arithmetic_expression(ConstantValue v1, const char *op,
+                                           ConstantValue v2)
+{
+    if (v1.is_float || v2.is_float) {
+        double d1 = constant_as_double(v1), d2 = constant_as_double(v2);
+
+        switch (op[0]) {
+        case '*': return float_constant(d1 * d2);
+        case '/': return float_constant(d1 / d2);
+        case '+': return float_constant(d1 + d2);
+        case '-': return float_constant(d1 - d2);
+        case '<': if (op[1] != '<') return int_constant(op[1] ? d1 <= d2 : d1 < d2); break;
+        case '>': if (op[1] != '>') return int_constant(op[1] ? d1 >= d2 : d1 > d2); break;
+        case '=': return int_constant(d1 == d2);
+        case '!': return int_constant(d1 != d2);
+        case '&': if (op[1]) return int_constant(d1 != 0.0 && d2 != 0.0); break;
+        case '|': if (op[1]) return int_constant(d1 != 0.0 || d2 != 0.0); break;
+        default: break;
+        }
+    } else {
+        int64_t i1 = v1.i, i2 = v2.i;
+
+        if ((op[0] == '/' || op[0] == '%') && i2 == 0) {
+            fprintf(stderr, "Division by zero in constant expression\n");
+            exit(1);
+        }
+        if (op[1] == 0) {
+            switch (op[0]) {
+            case '^': return int_constant(i1 ^ i2);
+            case '|': return int_constant(i1 | i2);
+            case '&': return int_constant(i1 & i2);
+            case '+': return int_constant((int64_t) ((uint64_t) i1 + (uint64_t) i2));
+            case '-': return int_constant((int64_t) ((uint64_t) i1 - (uint64_t) i2));
+            case '*': return int_constant((int64_t) ((uint64_t) i1 * (uint64_t) i2));
+            case '/': return int_constant(i1 / i2);
+            case '%': return int_constant(i1 % i2);
+            case '<': return int_constant(i1 < i2);
+            case '>': return int_constant(i1 > i2);
+            default: break;
+            }
+        } else {
+#define TWOCHARCODE(a, b) ((a << 8) | b)
+#define TWOCHARTAG(expr) (TWOCHARCODE(expr[0], expr[1]))
+            switch (TWOCHARTAG(op)) {
+            case TWOCHARCODE('<', '='): return int_constant(i1 <= i2);
+            case TWOCHARCODE('>', '='): return int_constant(i1 >= i2);
+            case TWOCHARCODE('!', '='): return int_constant(i1 != i2);
+            case TWOCHARCODE('=', '='): return int_constant(i1 == i2);
+            case TWOCHARCODE('&', '&'): return int_constant(i1 && i2);
+            case TWOCHARCODE('|', '|'): return int_constant(i1 || i2);
+            case TWOCHARCODE('<', '<'): return int_constant((int64_t) ((uint64_t) i1 << (i2 & 63)));
+            case TWOCHARCODE('>', '>'): return int_constant(i1 >> (i2 & 63));
+            default: break;
+            }
+        }
+    }
+
+    fprintf(stderr, "Arithmetic expression '%s' not handled\n", op);
+    exit(1);
+}
+
+static ConstantValue eval_binary(ConstantParser *p, unsigned min_prec)
+{
+    ConstantValue left = eval_unary(p), right;
+
+    for (;;) {
+        const char *op = peek_constant_token(p);
+        unsigned prec = binary_precedence(op), skip;
+
+        if (!prec || prec < min_prec)
+            return left;
+        p->n++;
+        // only parse the right operand of && and || if the left one
+        // decides the result, as in 'N && 100 / N'
+        skip = (!strcmp(op, "&&") && constant_as_double(left) == 0.0) ||
+               (!strcmp(op, "||") && constant_as_double(left) != 0.0);
+        p->skip += skip;
+        right = eval_binary(p, prec + 1);
+        p->skip -= skip;
+        if (!p->skip)
+            left = arithmetic_expression(left, op, right);
+    }
+}
+
+static ConstantValue eval_conditional(ConstantParser *p)
+{
+    ConstantValue cond = eval_binary(p, 1), v1, v2;
+    unsigned is_true;
+
+    if (strcmp(peek_constant_token(p), "?"))
+        return cond;
+    p->n++;
+    // the branch not taken is only parsed
+    is_true = constant_as_double(cond) != 0.0;
+    p->skip += !is_true;
+    v1 = eval_conditional(p);
+    p->skip -= !is_true;
+    if (strcmp(peek_constant_token(p), ":")) {
+        fprintf(stderr, "Unable to parse conditional expression\n");
+        exit(1);
+    }
+    p->n++;
+    p->skip += is_true;
+    v2 = eval_conditional(p);
+    p->skip -= is_true;
+
+    return is_true ? v1 : v2;
+}
+
+/*
+ * Evaluate spellings[0..n_spellings-1] as a constant expression. If
+ * max_unused is non-zero, that number of trailing tokens may be left
+ * unparsed (the token range of a cursor may include the first token
+ * after it).
+ */
+static ConstantValue eval_spellings(const char **spellings,
+                                    unsigned n_spellings, unsigned max_unused)
+{
+    ConstantParser p;
+    ConstantValue v;
+
+    p.spellings = spellings;
+    p.n = 0;
+    p.last = n_spellings - 1;
+    p.skip = 0;
+
+    v = eval_conditional(&p);
+    if (p.n + max_unused <= p.last) {
+        fprintf(stderr, "Unable to parse tokens as expression\n");
+        exit(1);
+    }
+
+    return v;
+}
+
+static ConstantValue eval_tokens(CXToken *tokens, unsigned first,
+                                 unsigned last, unsigned max_unused)
+{
+    const char **spellings;
+    ConstantValue v;
+    unsigned n;
+
+    spellings = (const char **) malloc(sizeof(*spellings) * (last - first + 1));
+    if (!spellings) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (n = first; n <= last; n++) {
+        CXString s = clang_getTokenSpelling(TU, tokens[n]);
+        spellings[n - first] = strdup(clang_getCString(s));
+        clang_disposeString(s);
+    }
+
+    v = eval_spellings(spellings, last - first + 1, max_unused);
+
+    for (n = first; n <= last; n++)
+        free((char *) spellings[n - first]);
+    free(spellings);
+
+    return v;
+}
+
+static ConstantCacheEntry *find_constant_cache_entry(CursorKey key)
+{
+    unsigned mask = n_allocated_constant_cache - 1;
+    unsigned n = key.hash & mask;
+
+    while (constant_cache[n].key.kind != 0 &&
+           !cursor_keys_equal(constant_cache[n].key, key))
+        n = (n + 1) & mask;
+
+    return &constant_cache[n];
+}
+
+static void grow_constant_cache(void)
+{
+    ConstantCacheEntry *old = constant_cache;
+    unsigned n, n_old = n_allocated_constant_cache;
+
+    n_allocated_constant_cache = n_old ? n_old * 2 : 256;
+    constant_cache = (ConstantCacheEntry *)
+        calloc(n_allocated_constant_cache, sizeof(*constant_cache));
+    if (!constant_cache) {
+        fprintf(stderr, "Out of memory while caching constants\n");
+        exit(1);
+    }
+    for (n = 0; n < n_old; n++) {
+        if (old[n].key.kind != 0)
+            *find_constant_cache_entry(old[n].key) = old[n];
+    }
+    free(old);
+}
+
+#if defined(HAVE_CURSOR_EVALUATE)
+static int evaluate_cursor(CXCursor cursor, int64_t *value)
+{
+    CXEvalResult res = clang_Cursor_Evaluate(cursor);
+    int ok = 0;
+
+    if (!res)
+        return 0;
+    if (clang_EvalResult_getKind(res) == CXEval_Int) {
+#if defined(HAVE_EVAL_RESULT_LONGLONG)
+        if (clang_EvalResult_isUnsignedInt(res))
+            *value = (int64_t) clang_EvalResult_getAsUnsigned(res);
+        else
+            *value = clang_EvalResult_getAsLongLong(res);
+#else
+        *value = clang_EvalResult_getAsInt(res);
+#endif
+        ok = 1;
+    }
+    clang_EvalResult_dispose(res);
+
+    return ok;
+}
+#endif
+
+static int64_t evaluate_integer_constant(CXCursor cursor)
+{
+    ConstantCacheEntry *e;
+    CursorKey key = cursor_key(cursor);
+    int64_t value;
+
+    if (n_constant_cache * 4 >= n_allocated_constant_cache * 3)
+        grow_constant_cache();
+    e = find_constant_cache_entry(key);
+    if (e->key.kind != 0)
+        return e->value;
+
+    if (cursor.kind == CXCursor_EnumConstantDecl) {
+        value = clang_getEnumConstantDeclValue(cursor);
+    } else
+#if defined(HAVE_CURSOR_EVALUATE)
+    if (!evaluate_cursor(cursor, &value))
+#endif
+    {
+        CXToken *tokens = 0;
+        unsigned n_tokens = 0;
+        CXSourceRange range = clang_getCursorExtent(cursor);
+
+        clang_tokenize(TU, range, &tokens, &n_tokens);
+        if (!n_tokens) {
+            fprintf(stderr, "Unable to parse an expression primary, no more tokens\n");
+            exit(1);
+        }
+        value = constant_as_int(eval_tokens(tokens, 0, n_tokens - 1, 1));
+        clang_disposeTokens(TU, tokens, n_tokens);
+    }
+
+    // evaluation may have recursed into the cache and grown it
+    e = find_constant_cache_entry(key);
+    e->key = key;
+    e->value = value;
+    n_constant_cache++;
+
+    return value;
+}
+
+static enum CXChildVisitResult fill_enum_members(CXCursor cursor,
+                                                 CXCursor parent,
+                                                 CXClientData client_data)
+{
+    EnumDeclaration *decl = (EnumDeclaration *) client_data;
+
+    if (cursor.kind == CXCursor_EnumConstantDecl) {
+        CXString cstr = clang_getCursorSpelling(cursor);
+        const char *str = clang_getCString(cstr);
+        unsigned n = decl->n_entries;
+
+        if (decl->n_entries == decl->n_allocated_entries)
+            decl->entries = (EnumMember *)
+                arena_grow_array(decl->entries, decl->n_entries,
+                                 &decl->n_allocated_entries,
+                                 sizeof(*decl->entries));
+
+        decl->entries[n].name = arena_strdup(str);
+        decl->entries[n].value = evaluate_integer_constant(cursor);
+        decl->n_entries++;
+
+        clang_disposeString(cstr);
+    }
+
+    return CXChildVisit_Continue;
 }
 
 static void register_enum(const char *str, CXCursor cursor,
@@ -737,10 +1756,11 @@ static void register_enum(const char *str, CXCursor cursor,
 {
     unsigned n;
     EnumDeclaration *decl;
+    CursorKey key = cursor_key(cursor);
 
     for (n = 0; n < n_enums; n++) {
         if ((str[0] != 0 && !strcmp(enums[n].name, str)) ||
-            !memcmp(&cursor, &enums[n].cursor, sizeof(cursor))) {
+            (!registry_frozen && cursor_keys_equal(key, enums[n].key))) {
             /* already exists */
             if (decl_ptr)
                 decl_ptr->enum_decl_idx = n;
@@ -748,22 +1768,17 @@ static void register_enum(const char *str, CXCursor cursor,
         }
     }
 
-    if (n_enums == n_allocated_enums) {
-        unsigned num = n_allocated_enums + 16;
-        void *mem = realloc(enums, sizeof(*enums) * num);
-        if (!mem) {
-            fprintf(stderr, "Out of memory while registering enum %s\n", str);
-            exit(1);
-        }
-        enums = (EnumDeclaration *) mem;
-        n_allocated_enums = num;
-    }
+    if (n_enums == n_allocated_enums)
+        enums = (EnumDeclaration *)
+            arena_grow_array(enums, n_enums, &n_allocated_enums,
+                             sizeof(*enums));
 
     if (decl_ptr)
         decl_ptr->enum_decl_idx = n_enums;
     decl = &enums[n_enums++];
-    decl->name = strdup(str);
-    decl->cursor = cursor;
+    stats.enums++;
+    decl->name = arena_strdup(str);
+    decl->key = key;
     decl->n_entries = 0;
     decl->n_allocated_entries = 0;
     decl->entries = NULL;
@@ -773,24 +1788,18 @@ static void register_enum(const char *str, CXCursor cursor,
 
 static void register_typedef(const char *name,
                              CXToken *tokens, unsigned n_tokens,
-                             TypedefDeclaration *decl, CXCursor cursor)
+                             TypedefDeclaration *decl)
 {
     unsigned n;
 
-    if (n_typedefs == n_allocated_typedefs) {
-        unsigned num = n_allocated_typedefs + 16;
-        void *mem = realloc(typedefs, sizeof(*typedefs) * num);
-        if (!mem) {
-            fprintf(stderr, "Ran out of memory while declaring typedef %s\n",
-                    name);
-            exit(1);
-        }
-        n_allocated_typedefs = num;
-        typedefs = (TypedefDeclaration *) mem;
-    }
+    if (n_typedefs == n_allocated_typedefs)
+        typedefs = (TypedefDeclaration *)
+            arena_grow_array(typedefs, n_typedefs, &n_allocated_typedefs,
+                             sizeof(*typedefs));
 
     n = n_typedefs++;
-    typedefs[n].name = strdup(name);
+    stats.typedefs++;
+    typedefs[n].name = arena_strdup(name);
     if (decl->struct_decl_idx != (unsigned) -1) {
         typedefs[n].struct_decl_idx = decl->struct_decl_idx;
         typedefs[n].proxy = NULL;
@@ -800,11 +1809,770 @@ static void register_typedef(const char *name,
         typedefs[n].struct_decl_idx = (unsigned) -1;
         typedefs[n].proxy = NULL;
     } else {
+        char *proxy = concat_name(tokens, 1, n_tokens - 3);
+
         typedefs[n].enum_decl_idx = (unsigned) -1;
         typedefs[n].struct_decl_idx = (unsigned) -1;
-        typedefs[n].proxy = concat_name(tokens, 1, n_tokens - 3);
+        typedefs[n].proxy = intern_string(proxy);
+        free(proxy);
+    }
+}
+
+static double get_time(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+#endif
+}
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t len)
+{
+    const unsigned char *p = data;
+    size_t n;
+
+    for (n = 0; n < len; n++)
+        hash = (hash ^ p[n]) * 0x100000001b3ULL; // FNV-1a, 64-bit
+
+    return hash;
+}
+
+static char *read_file(const char *name, size_t *len)
+{
+    FILE *f = fopen(name, "rb");
+    char *buf = NULL;
+    size_t n_allocated = 0;
+
+    *len = 0;
+    if (!f)
+        return NULL;
+    for (;;) {
+        size_t n;
+        if (*len == n_allocated) {
+            n_allocated += 65536;
+            buf = (char *) realloc(buf, n_allocated);
+            if (!buf) {
+                fprintf(stderr, "Out of memory while reading %s\n", name);
+                exit(1);
+            }
+        }
+        n = fread(buf + *len, 1, n_allocated - *len, f);
+        if (n == 0)
+            break;
+        *len += n;
+    }
+    fclose(f);
+
+    return buf;
+}
+
+static int file_exists(const char *name)
+{
+    FILE *f = fopen(name, "rb");
+
+    if (!f)
+        return 0;
+    fclose(f);
+    return 1;
+}
+
+static size_t file_size(const char *name)
+{
+    FILE *f = fopen(name, "rb");
+    long size;
+
+    if (!f)
+        return 0;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fclose(f);
+
+    return size < 0 ? 0 : (size_t) size;
+}
+
+/*
+ * The AST cache is keyed by the input name (if any, along with the working
+ * directory that it and relative include paths depend on) and contents,
+ * the parser arguments and the libclang version. The TU is parsed with the
+ * contents passed as an unsaved file, which the AST then embeds, so that
+ * its source locations stay valid when it is loaded back in a later run
+ * even if the input was rewritten since. The headers it includes are
+ * checked separately, see save_cache_deps().
+ */
+static uint64_t cache_key(const char *name, const char *data, size_t len,
+                          const char **argv, int argc)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    CXString version = clang_getClangVersion();
+    const char *v = clang_getCString(version);
+    int n;
+
+    if (name) {
+        char cwd[4096];
+#ifdef _WIN32
+        if (_getcwd(cwd, sizeof(cwd)))
+#else
+        if (getcwd(cwd, sizeof(cwd)))
+#endif
+            hash = hash_bytes(hash, cwd, strlen(cwd) + 1);
+        hash = hash_bytes(hash, name, strlen(name) + 1);
+    }
+    hash = hash_bytes(hash, data, len);
+    for (n = 0; n < argc; n++)
+        hash = hash_bytes(hash, argv[n], strlen(argv[n]) + 1);
+    hash = hash_bytes(hash, v, strlen(v));
+    clang_disposeString(version);
+
+    return hash;
+}
+
+static int replace_file(const char *from, const char *to)
+{
+#ifdef _WIN32
+    // rename() does not replace existing files on Windows
+    return !MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING);
+#else
+    return rename(from, to);
+#endif
+}
+
+/* Whether the two files exist and have the same contents */
+static int same_contents(const char *a, const char *b)
+{
+    FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+    char buf_a[65536], buf_b[65536];
+    size_t n_a, n_b;
+    int res = 0;
+
+    if (fa && fb) {
+        do {
+            n_a = fread(buf_a, 1, sizeof(buf_a), fa);
+            n_b = fread(buf_b, 1, sizeof(buf_b), fb);
+        } while (n_a == n_b && n_a && !memcmp(buf_a, buf_b, n_a));
+        res = n_a == n_b && !n_a;
+    }
+    if (fa)
+        fclose(fa);
+    if (fb)
+        fclose(fb);
+
+    return res;
+}
+
+/*
+ * For -update: the output was written to tmp, which replaces name only if
+ * their contents differ, so that unchanged outputs keep their mtime.
+ */
+static int update_file(const char *tmp, const char *name)
+{
+    if (same_contents(tmp, name)) {
+        remove(tmp);
+        return 0;
+    }
+    if (replace_file(tmp, name)) {
+        fprintf(stderr, "Unable to write output file %s\n", name);
+        remove(tmp);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int write_file_atomic(const char *name, const char *data, size_t len)
+{
+    char tmp[4096 + 32];
+    FILE *f;
+
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", name, (int) getpid());
+    f = fopen(tmp, "wb");
+    if (!f)
+        return 0;
+    if (fwrite(data, 1, len, f) != len) {
+        fclose(f);
+        remove(tmp);
+        return 0;
     }
-    memcpy(&typedefs[n].cursor, &cursor, sizeof(cursor));
+    fclose(f);
+    if (replace_file(tmp, name)) {
+        remove(tmp);
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Registry snapshots. Preprocessed input starts with a long run of header
+ * code, delimited by line markers ('# 12 "foo.h"' or '#line 12 "foo.h"'),
+ * which is often identical across the translation units of a project. At
+ * every return from a top-level #include within that prefix, the registry
+ * is saved to <cache dir>/<hash>.reg, keyed by a hash of all input bytes up
+ * to that point. When a later conversion finds a snapshot for its longest
+ * matching prefix, it maps the file and uses it as the registry, and the
+ * visitor only looks up (but doesn't register) declarations before the end
+ * of that prefix.
+ *
+ * The name of the main file is left out of the hash, since it appears in
+ * line markers but doesn't affect the registry. Cursor keys aren't
+ * comparable across translation units, so while the registry is frozen,
+ * declarations are only matched by name, and anonymous ones that are
+ * needed (e.g. 'static struct { int x; } var = { .x = 1 };') are simply
+ * registered again.
+ *
+ * The file is a header, followed by arrays of fixed-size records, followed
+ * by a pool of nul-terminated strings that records refer to by offset, so
+ * registry strings can point straight into the mapping.
+ */
+#define REGISTRY_MAGIC "c99reg\002"
+#define REGISTRY_NO_STRING 0xffffffffU
+
+typedef struct {
+    char magic[8];
+    uint32_t n_structs, n_struct_members;
+    uint32_t n_enums, n_enum_members;
+    uint32_t n_typedefs, pool_size;
+} RegistryHeader;
+
+typedef struct {
+    int64_t value;
+    uint32_t name, pad;
+} EnumMemberRecord;
+
+typedef struct {
+    uint32_t name, first_member, n_members, is_union;
+} StructRecord;
+
+typedef struct {
+    uint32_t type, name, struct_decl_idx, n_ptrs, array_depth;
+} StructMemberRecord;
+
+typedef struct {
+    uint32_t name, first_member, n_members;
+} EnumRecord;
+
+typedef struct {
+    uint32_t name, proxy, struct_decl_idx, enum_decl_idx;
+} TypedefRecord;
+
+typedef struct {
+    unsigned offset; // start of the line marker returning to the main file
+    uint64_t hash;   // of the input bytes before offset
+} RegistryBoundary;
+static RegistryBoundary *registry_boundaries = NULL;
+static unsigned n_registry_boundaries = 0;
+static unsigned n_allocated_registry_boundaries = 0;
+static unsigned next_registry_boundary = 0;
+static unsigned frozen_registry_end = 0;
+static const char *registry_dir = NULL;
+static CXFile registry_file = NULL;
+static void *registry_map = NULL;
+static size_t registry_map_size = 0;
+
+static void *map_file(const char *name, size_t *size)
+{
+#ifdef _WIN32
+    HANDLE file, mapping;
+    void *ptr;
+
+    file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    *size = GetFileSize(file, NULL);
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+        return NULL;
+    ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    return ptr;
+#else
+    struct stat st;
+    void *ptr;
+    int fd = open(name, O_RDONLY);
+
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    *size = st.st_size;
+    ptr = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    return ptr == MAP_FAILED ? NULL : ptr;
+#endif
+}
+
+static void unmap_file(void *ptr, size_t size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(ptr);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+/*
+ * Parses the line marker at p, if any, and returns the (raw, unescaped)
+ * file name in *name and *name_len, and the line number in *line.
+ */
+static int parse_line_marker(const char *p, const char *end,
+                             const char **name, unsigned *name_len,
+                             unsigned *line)
+{
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+    if (p == end || *p++ != '#')
+        return 0;
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+    if (end - p > 4 && !strncmp(p, "line", 4))
+        p += 4;
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+    if (p == end || *p < '0' || *p > '9')
+        return 0;
+    for (*line = 0; p < end && *p >= '0' && *p <= '9'; p++)
+        *line = *line * 10 + *p - '0';
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+    if (p == end || *p++ != '"')
+        return 0;
+    *name = p;
+    while (p < end && *p != '"' && *p != '\n')
+        p += *p == '\\' && p + 1 < end ? 2 : 1;
+    if (p == end || *p != '"')
+        return 0;
+    *name_len = (unsigned) (p - *name);
+
+    return 1;
+}
+
+static void find_registry_boundaries(const char *data, size_t len,
+                                     uint64_t seed)
+{
+    const char *main_name = NULL, *p = data, *end = data + len;
+    unsigned main_len = 0;
+    int in_main = 1, seen_header = 0;
+    uint64_t hash = seed;
+
+    while (p < end) {
+        const char *eol = memchr(p, '\n', end - p);
+        const char *name;
+        unsigned name_len, line;
+
+        eol = eol ? eol + 1 : end;
+        if (parse_line_marker(p, eol, &name, &name_len, &line)) {
+            if (!main_name) {
+                main_name = name;
+                main_len = name_len;
+            }
+            in_main = name_len == main_len &&
+                      !memcmp(name, main_name, name_len);
+            if (in_main && seen_header) {
+                if (n_registry_boundaries == n_allocated_registry_boundaries) {
+                    unsigned num = n_allocated_registry_boundaries + 16;
+                    void *mem = realloc(registry_boundaries,
+                                        sizeof(*registry_boundaries) * num);
+                    if (!mem) {
+                        fprintf(stderr, "Failed to allocate boundary mem\n");
+                        exit(1);
+                    }
+                    registry_boundaries = (RegistryBoundary *) mem;
+                    n_allocated_registry_boundaries = num;
+                }
+                registry_boundaries[n_registry_boundaries].offset =
+                    (unsigned) (p - data);
+                registry_boundaries[n_registry_boundaries].hash = hash;
+                n_registry_boundaries++;
+            }
+            seen_header |= !in_main;
+            if (in_main) {
+                hash = hash_bytes(hash, p, name - p);
+                hash = hash_bytes(hash, name + name_len,
+                                  eol - (name + name_len));
+                p = eol;
+                continue;
+            }
+        } else if (in_main) {
+            const char *q = p;
+            while (q < eol && (*q == ' ' || *q == '\t' ||
+                               *q == '\r' || *q == '\n'))
+                q++;
+            // first line of main file code: end of the header prefix
+            if (q < eol)
+                break;
+        }
+        hash = hash_bytes(hash, p, eol - p);
+        p = eol;
+    }
+}
+
+static void registry_snapshot_name(char *name, size_t size, uint64_t hash)
+{
+    snprintf(name, size, "%s/%016"PRIx64".reg", registry_dir, hash);
+}
+
+static const char *registry_string(const char *pool, uint32_t off)
+{
+    return off == REGISTRY_NO_STRING ? NULL : pool + off;
+}
+
+#define VALID_STRING(off) \
+    ((off) == REGISTRY_NO_STRING || (off) < h->pool_size)
+#define VALID_INDEX(idx, n) ((idx) == (uint32_t) -1 || (idx) < (n))
+
+static int registry_snapshot_valid(const RegistryHeader *h,
+                                   const EnumMemberRecord *em,
+                                   const StructRecord *sr,
+                                   const StructMemberRecord *smr,
+                                   const EnumRecord *er,
+                                   const TypedefRecord *tr)
+{
+    unsigned n;
+
+    for (n = 0; n < h->n_enum_members; n++)
+        if (!VALID_STRING(em[n].name))
+            return 0;
+    for (n = 0; n < h->n_structs; n++)
+        if (!VALID_STRING(sr[n].name) ||
+            sr[n].first_member > h->n_struct_members ||
+            sr[n].n_members > h->n_struct_members - sr[n].first_member)
+            return 0;
+    for (n = 0; n < h->n_struct_members; n++)
+        if (!VALID_STRING(smr[n].type) || !VALID_STRING(smr[n].name) ||
+            !VALID_INDEX(smr[n].struct_decl_idx, h->n_structs))
+            return 0;
+    for (n = 0; n < h->n_enums; n++)
+        if (!VALID_STRING(er[n].name) ||
+            er[n].first_member > h->n_enum_members ||
+            er[n].n_members > h->n_enum_members - er[n].first_member)
+            return 0;
+    for (n = 0; n < h->n_typedefs; n++)
+        if (!VALID_STRING(tr[n].name) || !VALID_STRING(tr[n].proxy) ||
+            !VALID_INDEX(tr[n].struct_decl_idx, h->n_structs) ||
+            !VALID_INDEX(tr[n].enum_decl_idx, h->n_enums))
+            return 0;
+
+    return 1;
+}
+
+static int load_registry_snapshot(const char *name)
+{
+    const RegistryHeader *h;
+    const EnumMemberRecord *em;
+    const StructRecord *sr;
+    const StructMemberRecord *smr;
+    const EnumRecord *er;
+    const TypedefRecord *tr;
+    const char *pool;
+    size_t size, need;
+    unsigned n, m;
+    void *map = map_file(name, &size);
+
+    if (!map)
+        return 0;
+
+    h = (const RegistryHeader *) map;
+    need = sizeof(*h);
+    if (size >= need)
+        need += (size_t) h->n_enum_members * sizeof(*em) +
+                (size_t) h->n_structs * sizeof(*sr) +
+                (size_t) h->n_struct_members * sizeof(*smr) +
+                (size_t) h->n_enums * sizeof(*er) +
+                (size_t) h->n_typedefs * sizeof(*tr) + h->pool_size;
+    if (size < sizeof(*h) || memcmp(h->magic, REGISTRY_MAGIC, 8) ||
+        size != need || !h->pool_size || ((const char *) map)[size - 1]) {
+        dprintf("Ignoring invalid registry snapshot %s\n", name);
+        unmap_file(map, size);
+        return 0;
+    }
+    em   = (const EnumMemberRecord *) (h + 1);
+    sr   = (const StructRecord *) (em + h->n_enum_members);
+    smr  = (const StructMemberRecord *) (sr + h->n_structs);
+    er   = (const EnumRecord *) (smr + h->n_struct_members);
+    tr   = (const TypedefRecord *) (er + h->n_enums);
+    pool = (const char *) (tr + h->n_typedefs);
+    if (!registry_snapshot_valid(h, em, sr, smr, er, tr)) {
+        dprintf("Ignoring corrupt registry snapshot %s\n", name);
+        unmap_file(map, size);
+        return 0;
+    }
+
+    // the snapshot replaces the (empty) registry
+    structs = (StructDeclaration *)
+        arena_alloc(sizeof(*structs) * (h->n_structs ? h->n_structs : 1));
+    n_structs = n_allocated_structs = h->n_structs;
+    for (n = 0; n < h->n_structs; n++) {
+        StructDeclaration *decl = &structs[n];
+        decl->name = (char *) registry_string(pool, sr[n].name);
+        memset(&decl->key, 0, sizeof(decl->key));
+        decl->is_union = sr[n].is_union;
+        decl->n_entries = decl->n_allocated_entries = sr[n].n_members;
+        decl->entries = NULL;
+        if (sr[n].n_members)
+            decl->entries = (StructMember *)
+                arena_alloc(sizeof(*decl->entries) * sr[n].n_members);
+        for (m = 0; m < sr[n].n_members; m++) {
+            const StructMemberRecord *r = &smr[sr[n].first_member + m];
+            decl->entries[m].type = registry_string(pool, r->type);
+            decl->entries[m].name = (char *) registry_string(pool, r->name);
+            decl->entries[m].struct_decl_idx = r->struct_decl_idx;
+            decl->entries[m].n_ptrs = r->n_ptrs;
+            decl->entries[m].array_depth = r->array_depth;
+        }
+    }
+
+    enums = (EnumDeclaration *)
+        arena_alloc(sizeof(*enums) * (h->n_enums ? h->n_enums : 1));
+    n_enums = n_allocated_enums = h->n_enums;
+    for (n = 0; n < h->n_enums; n++) {
+        EnumDeclaration *decl = &enums[n];
+        decl->name = (char *) registry_string(pool, er[n].name);
+        memset(&decl->key, 0, sizeof(decl->key));
+        decl->n_entries = decl->n_allocated_entries = er[n].n_members;
+        decl->entries = NULL;
+        if (er[n].n_members)
+            decl->entries = (EnumMember *)
+                arena_alloc(sizeof(*decl->entries) * er[n].n_members);
+        for (m = 0; m < er[n].n_members; m++) {
+            const EnumMemberRecord *r = &em[er[n].first_member + m];
+            decl->entries[m].name = (char *) registry_string(pool, r->name);
+            decl->entries[m].value = r->value;
+        }
+    }
+
+    typedefs = (TypedefDeclaration *)
+        arena_alloc(sizeof(*typedefs) * (h->n_typedefs ? h->n_typedefs : 1));
+    n_typedefs = n_allocated_typedefs = h->n_typedefs;
+    for (n = 0; n < h->n_typedefs; n++) {
+        typedefs[n].name = (char *) registry_string(pool, tr[n].name);
+        typedefs[n].proxy = registry_string(pool, tr[n].proxy);
+        typedefs[n].struct_decl_idx = tr[n].struct_decl_idx;
+        typedefs[n].enum_decl_idx = tr[n].enum_decl_idx;
+    }
+
+    registry_map = map;
+    registry_map_size = size;
+
+    return 1;
+}
+
+typedef struct {
+    char *data;
+    size_t size, n_allocated;
+} SnapshotBuffer;
+
+static uint32_t snapshot_append(SnapshotBuffer *b, const void *data,
+                                size_t size)
+{
+    size_t off = b->size;
+
+    if (b->size + size > b->n_allocated) {
+        size_t num = b->n_allocated + size + 65536;
+        void *mem = realloc(b->data, num);
+        if (!mem) {
+            fprintf(stderr, "Failed to allocate snapshot mem\n");
+            exit(1);
+        }
+        b->data = (char *) mem;
+        b->n_allocated = num;
+    }
+    memcpy(b->data + b->size, data, size);
+    b->size += size;
+
+    return (uint32_t) off;
+}
+
+// strings are deduplicated, since member types repeat a lot
+typedef struct {
+    const char *str;
+    uint32_t off;
+} PoolEntry;
+
+static uint32_t snapshot_string(SnapshotBuffer *pool, PoolEntry *table,
+                                unsigned mask, const char *str)
+{
+    unsigned n;
+
+    if (!str)
+        return REGISTRY_NO_STRING;
+    n = hash_string(str) & mask;
+    while (table[n].str && strcmp(table[n].str, str))
+        n = (n + 1) & mask;
+    if (!table[n].str) {
+        table[n].str = str;
+        table[n].off = snapshot_append(pool, str, strlen(str) + 1);
+    }
+
+    return table[n].off;
+}
+
+static void save_registry_snapshot(uint64_t hash)
+{
+    SnapshotBuffer rec = { NULL, 0, 0 }, pool = { NULL, 0, 0 };
+    RegistryHeader h;
+    PoolEntry *table;
+    unsigned n, m, mask = 255, n_strings = n_typedefs * 2;
+    uint32_t first;
+    char name[4096];
+
+    registry_snapshot_name(name, sizeof(name), hash);
+    if (file_exists(name))
+        return;
+
+    for (n = 0; n < n_structs; n++)
+        n_strings += 1 + structs[n].n_entries * 2;
+    for (n = 0; n < n_enums; n++)
+        n_strings += 1 + enums[n].n_entries;
+    while (mask < n_strings * 2)
+        mask = mask * 2 + 1;
+    table = (PoolEntry *) calloc(mask + 1, sizeof(*table));
+    if (!table) {
+        fprintf(stderr, "Failed to allocate snapshot mem\n");
+        exit(1);
+    }
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, REGISTRY_MAGIC, 8);
+    h.n_structs = n_structs;
+    h.n_enums = n_enums;
+    h.n_typedefs = n_typedefs;
+    snapshot_append(&rec, &h, sizeof(h));
+
+    for (n = 0; n < n_enums; n++) {
+        for (m = 0; m < enums[n].n_entries; m++) {
+            EnumMemberRecord r;
+            memset(&r, 0, sizeof(r));
+            r.value = enums[n].entries[m].value;
+            r.name = snapshot_string(&pool, table, mask,
+                                     enums[n].entries[m].name);
+            snapshot_append(&rec, &r, sizeof(r));
+            h.n_enum_members++;
+        }
+    }
+    for (n = 0, first = 0; n < n_structs; n++) {
+        StructRecord r;
+        r.name = snapshot_string(&pool, table, mask, structs[n].name);
+        r.first_member = first;
+        r.n_members = structs[n].n_entries;
+        r.is_union = structs[n].is_union;
+        snapshot_append(&rec, &r, sizeof(r));
+        first += structs[n].n_entries;
+    }
+    for (n = 0; n < n_structs; n++) {
+        for (m = 0; m < structs[n].n_entries; m++) {
+            StructMember *member = &structs[n].entries[m];
+            StructMemberRecord r;
+            r.type = snapshot_string(&pool, table, mask, member->type);
+            r.name = snapshot_string(&pool, table, mask, member->name);
+            r.struct_decl_idx = member->struct_decl_idx;
+            r.n_ptrs = member->n_ptrs;
+            r.array_depth = member->array_depth;
+            snapshot_append(&rec, &r, sizeof(r));
+            h.n_struct_members++;
+        }
+    }
+    for (n = 0, first = 0; n < n_enums; n++) {
+        EnumRecord r;
+        r.name = snapshot_string(&pool, table, mask, enums[n].name);
+        r.first_member = first;
+        r.n_members = enums[n].n_entries;
+        snapshot_append(&rec, &r, sizeof(r));
+        first += enums[n].n_entries;
+    }
+    for (n = 0; n < n_typedefs; n++) {
+        TypedefRecord r;
+        r.name = snapshot_string(&pool, table, mask, typedefs[n].name);
+        r.proxy = snapshot_string(&pool, table, mask, typedefs[n].proxy);
+        r.struct_decl_idx = typedefs[n].struct_decl_idx;
+        r.enum_decl_idx = typedefs[n].enum_decl_idx;
+        snapshot_append(&rec, &r, sizeof(r));
+    }
+    if (!pool.size)
+        snapshot_string(&pool, table, mask, "");
+
+    h.pool_size = (uint32_t) pool.size;
+    memcpy(rec.data, &h, sizeof(h));
+    snapshot_append(&rec, pool.data, pool.size);
+    if (!write_file_atomic(name, rec.data, rec.size))
+        dprintf("Unable to save registry snapshot %s\n", name);
+
+    free(table);
+    free(pool.data);
+    free(rec.data);
+}
+
+/*
+ * Set up snapshots for the conversion of data (the input contents); seed
+ * covers the parser arguments. Returns the length of the prefix that was
+ * loaded from a snapshot.
+ */
+static unsigned init_registry_snapshots(const char *dir, CXFile file,
+                                        const char *data, size_t len,
+                                        uint64_t seed)
+{
+    unsigned n;
+    char name[4096];
+
+    registry_dir = dir;
+    registry_file = file;
+    find_registry_boundaries(data, len, seed);
+    for (n = n_registry_boundaries; n > 0; n--) {
+        registry_snapshot_name(name, sizeof(name),
+                               registry_boundaries[n - 1].hash);
+        if (load_registry_snapshot(name)) {
+            frozen_registry_end = registry_boundaries[n - 1].offset;
+            next_registry_boundary = n;
+            dprintf("Loaded registry snapshot %s (%u of %u bytes)\n",
+                    name, frozen_registry_end, (unsigned) len);
+            break;
+        }
+    }
+
+    return frozen_registry_end;
+}
+
+/*
+ * Called for each top-level cursor, in source order. Offsets are only
+ * meaningful in the input file itself, so e.g. builtin macro definitions
+ * are ignored.
+ */
+static void registry_enter_top_level(CXFile file, unsigned off)
+{
+    if (file != registry_file)
+        return;
+    registry_frozen = off < frozen_registry_end;
+    while (next_registry_boundary < n_registry_boundaries &&
+           off >= registry_boundaries[next_registry_boundary].offset) {
+        save_registry_snapshot(registry_boundaries[next_registry_boundary].hash);
+        next_registry_boundary++;
+    }
+}
+
+static void release_registry_snapshots(void)
+{
+    if (registry_map)
+        unmap_file(registry_map, registry_map_size);
+    registry_map = NULL;
+    registry_map_size = 0;
+    free(registry_boundaries);
+    registry_boundaries = NULL;
+    n_registry_boundaries = n_allocated_registry_boundaries = 0;
+    next_registry_boundary = 0;
+    frozen_registry_end = 0;
+    registry_frozen = 0;
+    registry_dir = NULL;
+    registry_file = NULL;
 }
 
 static unsigned get_token_offset(CXToken token)
@@ -814,12 +2582,7 @@ static unsigned get_token_offset(CXToken token)
     unsigned line, col, off;
 
     clang_getSpellingLocation(l, &file, &line, &col, &off);
-    /* This debug output is intended as part of debugging indentation errors that I hope I fixed with NEW_INDENT */
-    if (DEBUG_LEVEL > 2) {
-        CXString spelling = clang_getTokenSpelling(TU, token);
-        dprintf("get_token_offset(%s): line=%d, col=%d, off(retval)=%d\n", clang_getCString(spelling), line, col, off);
-        clang_disposeString(spelling);
-    }
+    trace(TRACE_TOKEN, 0, off, line, col);
 
     return off;
 }
@@ -990,16 +2753,182 @@ typedef struct {
     unsigned struct_decl_idx; // struct type
     union {
         struct {
-            char *tmp_var_name; // temporary variable name for the constant
-                                // data, assigned in the first stage (var
-                                // declaration), and used in the second stage
-                                // (replacement of the CL with the var ref)
+            char tmp_var_name[16]; // temporary variable name for the constant
+                                   // data, assigned in the first stage (var
+                                   // declaration), and used in the second
+                                   // stage (replacement of the CL with the
+                                   // var ref)
         } t_c_d;
     } data;
 } CompoundLiteralList;
-static CompoundLiteralList *comp_literal_lists = NULL;
-static unsigned n_comp_literal_lists = 0;
-static unsigned n_allocated_comp_literal_lists = 0;
+static THREAD_LOCAL CompoundLiteralList *comp_literal_lists = NULL;
+static THREAD_LOCAL unsigned n_comp_literal_lists = 0;
+static THREAD_LOCAL unsigned n_allocated_comp_literal_lists = 0;
+
+static double stats_time(void)
+{
+    return stats.enabled ? get_time() : 0.0;
+}
+
+/* Adds the time since t0 to phase, and returns the current time */
+static double stats_lap(enum StatsPhase phase, double t0)
+{
+    double now;
+
+    if (!stats.enabled)
+        return 0.0;
+    now = get_time();
+    stats.time[phase] += now - t0;
+
+    return now;
+}
+
+// called by the thread that printed, with the emitter pool lock held if any
+static void merge_emit_stats(void)
+{
+    stats.time[PHASE_REORDER] += emit_stats.reorder;
+    stats.time[PHASE_EMIT] += emit_stats.emit;
+    stats.gap_fillers += emit_stats.gap_fillers;
+    memset(&emit_stats, 0, sizeof(emit_stats));
+}
+
+// counts the rewrites in this thread's lists, once they're complete
+static void count_decl_lists(void)
+{
+    unsigned n;
+
+    if (!stats.enabled)
+        return;
+    for (n = 0; n < n_comp_literal_lists; n++)
+        stats.comp_literals[comp_literal_lists[n].type]++;
+    for (n = 0; n < n_struct_array_lists; n++) {
+        stats.struct_lists += struct_array_lists[n].type == TYPE_STRUCT;
+        stats.array_lists += struct_array_lists[n].type == TYPE_ARRAY;
+    }
+    for (n = 0; n < n_end_scopes; n++)
+        stats.end_scopes += end_scopes[n].n_scopes;
+}
+
+static void print_json_string_len(FILE *f, const char *str, size_t len)
+{
+    fputc('"', f);
+    for (; len; str++, len--) {
+        if (*str == '"' || *str == '\\')
+            fprintf(f, "\\%c", *str);
+        else if ((unsigned char) *str < 0x20)
+            fprintf(f, "\\u%04x", (unsigned char) *str);
+        else
+            fputc(*str, f);
+    }
+    fputc('"', f);
+}
+
+static void print_json_string(FILE *f, const char *str)
+{
+    print_json_string_len(f, str, strlen(str));
+}
+
+/*
+ * dest is "json" for stderr, or a file that the line is appended to. The
+ * line is written with a single fflush(), so that concurrent conversions
+ * appending to the same file don't interleave.
+ */
+static void print_stats(const char *dest, const char *infile)
+{
+    static char buf[8192];
+    FILE *f = stderr;
+    unsigned n;
+
+    if (strcmp(dest, "json")) {
+        f = fopen(dest, "a");
+        if (!f) {
+            fprintf(stderr, "Unable to open stats file %s\n", dest);
+            return;
+        }
+        setvbuf(f, buf, _IOFBF, sizeof(buf));
+    }
+    fprintf(f, "{\"file\": ");
+    print_json_string(f, infile);
+    fprintf(f, ", \"time_ms\": {");
+    for (n = 0; n < N_PHASES; n++)
+        fprintf(f, "%s\"%s\": %.3f", n ? ", " : "", phase_names[n],
+                stats.time[n] * 1000.0);
+    fprintf(f, "}, \"tokens\": %u, \"cursors\": %u, \"structs\": %u, "
+            "\"enums\": %u, \"typedefs\": %u, \"compound_literals\": {",
+            stats.tokens, stats.cursors, stats.structs, stats.enums,
+            stats.typedefs);
+    for (n = 0; n < N_CL_TYPES; n++)
+        fprintf(f, "%s\"%s\": %u", n ? ", " : "", cl_type_names[n],
+                stats.comp_literals[n]);
+    fprintf(f, "}, \"struct_lists\": %u, \"array_lists\": %u, "
+            "\"gap_fillers\": %u, \"end_scopes\": %u, \"bytes_in\": %lu, "
+            "\"bytes_out\": %lu}\n", stats.struct_lists, stats.array_lists,
+            stats.gap_fillers, stats.end_scopes,
+            (unsigned long) stats.bytes_in, (unsigned long) stats.bytes_out);
+    if (f != stderr)
+        fclose(f);
+}
+
+typedef struct {
+    CompoundLiteralList *comp_literal_lists;
+    unsigned n_comp_literal_lists, n_allocated_comp_literal_lists;
+    StructArrayList *struct_array_lists;
+    unsigned n_struct_array_lists, n_allocated_struct_array_lists;
+    EndScope *end_scopes;
+    unsigned n_end_scopes, n_allocated_end_scopes;
+} DeclLists;
+
+/* Moves this thread's lists into *l, leaving this thread with empty lists */
+static void save_decl_lists(DeclLists *l)
+{
+    l->comp_literal_lists = comp_literal_lists;
+    l->n_comp_literal_lists = n_comp_literal_lists;
+    l->n_allocated_comp_literal_lists = n_allocated_comp_literal_lists;
+    l->struct_array_lists = struct_array_lists;
+    l->n_struct_array_lists = n_struct_array_lists;
+    l->n_allocated_struct_array_lists = n_allocated_struct_array_lists;
+    l->end_scopes = end_scopes;
+    l->n_end_scopes = n_end_scopes;
+    l->n_allocated_end_scopes = n_allocated_end_scopes;
+
+    comp_literal_lists = NULL;
+    n_comp_literal_lists = n_allocated_comp_literal_lists = 0;
+    struct_array_lists = NULL;
+    n_struct_array_lists = n_allocated_struct_array_lists = 0;
+    end_scopes = NULL;
+    n_end_scopes = n_allocated_end_scopes = 0;
+}
+
+static void load_decl_lists(const DeclLists *l)
+{
+    comp_literal_lists = l->comp_literal_lists;
+    n_comp_literal_lists = l->n_comp_literal_lists;
+    n_allocated_comp_literal_lists = l->n_allocated_comp_literal_lists;
+    struct_array_lists = l->struct_array_lists;
+    n_struct_array_lists = l->n_struct_array_lists;
+    n_allocated_struct_array_lists = l->n_allocated_struct_array_lists;
+    end_scopes = l->end_scopes;
+    n_end_scopes = l->n_end_scopes;
+    n_allocated_end_scopes = l->n_allocated_end_scopes;
+}
+
+static void free_decl_lists(void)
+{
+    unsigned n;
+
+    for (n = 0; n < n_struct_array_lists; n++)
+        free(struct_array_lists[n].entries);
+    free(struct_array_lists);
+    free(comp_literal_lists);
+    free(end_scopes);
+
+    struct_array_lists = NULL;
+    n_struct_array_lists = n_allocated_struct_array_lists = 0;
+    comp_literal_lists = NULL;
+    n_comp_literal_lists = n_allocated_comp_literal_lists = 0;
+    end_scopes = NULL;
+    n_end_scopes = n_allocated_end_scopes = 0;
+}
 
 /*
  * Helper struct for traversing the tree. This allows us to keep state
@@ -1024,10 +2953,121 @@ struct CursorRecursion {
         TypedefDeclaration *td_decl; // TypedefDecl
         unsigned cl_idx;             // CompoundLiteralExpr
     } data;
-    int is_function;
     int end_scopes;
+    /* Ancestor lookups, inherited from the parent level when this level
+     * is pushed (see push_cursor_recursion()), so they're O(1). */
+    CursorRecursion *function;       // nearest FunctionDecl, or NULL
+    CursorRecursion *compound;       // nearest CompoundStmt, or NULL
+    CursorRecursion *var_decl_ctx;   // see find_var_decl_context()
+    CursorRecursion *top;            // see find_function_or_top()
 };
 
+/*
+ * Recursion levels live in a stack of fixed-size blocks instead of on the
+ * C stack, so that pointers to parent levels remain valid while the stack
+ * grows, and blocks are reused between top-level declarations.
+ */
+#define CURSOR_STACK_BLOCK_SIZE 256
+typedef struct CursorStackBlock CursorStackBlock;
+struct CursorStackBlock {
+    CursorRecursion levels[CURSOR_STACK_BLOCK_SIZE];
+    CursorStackBlock *prev, *next;
+};
+static CursorStackBlock *cursor_stack = NULL;
+static unsigned cursor_stack_depth = 0;
+
+static CursorRecursion *push_cursor_recursion(enum CXCursorKind kind,
+                                              CursorRecursion *parent)
+{
+    CursorRecursion *rec;
+
+    if (!cursor_stack || cursor_stack_depth == CURSOR_STACK_BLOCK_SIZE) {
+        CursorStackBlock *b = cursor_stack ? cursor_stack->next : NULL;
+
+        if (!b) {
+            b = calloc(1, sizeof(*b));
+            if (!b) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            b->prev = cursor_stack;
+            if (cursor_stack)
+                cursor_stack->next = b;
+        }
+        cursor_stack = b;
+        cursor_stack_depth = 0;
+    }
+    rec = &cursor_stack->levels[cursor_stack_depth++];
+    memset(rec, 0, sizeof(*rec));
+    rec->kind = kind;
+    rec->parent = parent;
+    if (!parent)
+        return rec;
+
+    /* the parent's child_cntr stays fixed for as long as we're on the
+     * stack, so anything derived from it can be computed right here */
+    parent->child_cntr++;
+    rec->function = kind == CXCursor_FunctionDecl ? rec : parent->function;
+    rec->compound = kind == CXCursor_CompoundStmt ? rec : parent->compound;
+    rec->top = (parent->kind == CXCursor_FunctionDecl ||
+                parent->kind == CXCursor_TranslationUnit) ? rec : parent->top;
+
+    /* Find a recursion level in which we can declare a new context,
+     * i.e. a "{" or a "do {", within which we can declare new variables
+     * in a c89-compatible way. At the end of the returned recursion
+     * level's token range, we'll add a "}" or a "} while (0);". */
+    rec->var_decl_ctx = parent->var_decl_ctx;
+    switch (kind) {
+    case CXCursor_VarDecl:
+    case CXCursor_ReturnStmt:
+    case CXCursor_CompoundStmt:
+    case CXCursor_IfStmt:
+    case CXCursor_SwitchStmt:
+        rec->var_decl_ctx = rec;
+        break;
+    case CXCursor_CallExpr:
+    case CXCursor_CompoundAssignOperator:
+    case CXCursor_BinaryOperator:
+        // FIXME: do/while/for
+        if ((parent->kind == CXCursor_IfStmt && parent->child_cntr > 1) ||
+            (parent->kind == CXCursor_CaseStmt && parent->child_cntr > 1) ||
+            parent->kind == CXCursor_CompoundStmt ||
+            parent->kind == CXCursor_DefaultStmt) {
+            rec->var_decl_ctx = rec;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return rec;
+}
+
+static void pop_cursor_recursion(void)
+{
+    assert(cursor_stack);
+    if (--cursor_stack_depth == 0 && cursor_stack->prev) {
+        cursor_stack = cursor_stack->prev;
+        cursor_stack_depth = CURSOR_STACK_BLOCK_SIZE;
+    }
+}
+
+static void free_cursor_stack(void)
+{
+    CursorStackBlock *b, *next;
+
+    if (!cursor_stack)
+        return;
+    while (cursor_stack->prev)
+        cursor_stack = cursor_stack->prev;
+    for (b = cursor_stack; b; b = next) {
+        next = b->next;
+        free(b);
+    }
+    cursor_stack = NULL;
+    cursor_stack_depth = 0;
+}
+
 static unsigned find_encompassing_struct_decl(unsigned start, unsigned end,
                                               StructArrayList **ptr,
                                               CursorRecursion *rec,
@@ -1135,47 +3175,13 @@ static int is_const(CompoundLiteralList *l, CursorRecursion *rec)
 
 static CursorRecursion *find_function_or_top(CursorRecursion *rec)
 {
-    CursorRecursion *p;
-
-    for (p = rec; p->parent->kind != CXCursor_FunctionDecl &&
-         p->parent->kind != CXCursor_TranslationUnit; p = p->parent) ;
-
-    return p;
+    /* the outermost level below a FunctionDecl or the TranslationUnit */
+    return rec->top;
 }
 
 static CursorRecursion *find_var_decl_context(CursorRecursion *rec)
 {
-    CursorRecursion *p;
-
-    /* Find a recursion level in which we can declare a new context,
-     * i.e. a "{" or a "do {", within which we can declare new variables
-     * in a c89-compatible way. At the end of the returned recursion
-     * level's token range, we'll add a "}" or a "} while (0);". */
-    for (p = rec; p != NULL; p = p->parent) {
-        switch (p->kind) {
-        case CXCursor_VarDecl:
-        case CXCursor_ReturnStmt:
-        case CXCursor_CompoundStmt:
-        case CXCursor_IfStmt:
-        case CXCursor_SwitchStmt:
-            return p;
-        case CXCursor_CallExpr:
-        case CXCursor_CompoundAssignOperator:
-        case CXCursor_BinaryOperator:
-            // FIXME: do/while/for
-            if ((p->parent->kind == CXCursor_IfStmt && p->parent->child_cntr > 1) ||
-                (p->parent->kind == CXCursor_CaseStmt && p->parent->child_cntr > 1) ||
-                p->parent->kind == CXCursor_CompoundStmt ||
-                p->parent->kind == CXCursor_DefaultStmt) {
-                return p;
-            }
-            break;
-        default:
-            break;
-        }
-    }
-
-    return NULL;
+    return rec ? rec->var_decl_ctx : NULL;
 }
 
 static void analyze_compound_literal_lineage(CompoundLiteralList *l,
@@ -1367,7 +3373,7 @@ static char *find_variable_name(CursorRecursion *rec)
             char *name;
             clang_disposeString(spelling);
             spelling = clang_getTokenSpelling(TU, rec->tokens[n - 1]);
-            name = strdup(clang_getCString(spelling));
+            name = arena_strdup(clang_getCString(spelling));
             clang_disposeString(spelling);
             return name;
         }
@@ -1399,65 +3405,45 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
     CXSourceLocation pos;
     CXFile file;
     unsigned line, col, off, i;
-    CXString filename;
-    CursorRecursion rec, *rec_ptr;
-    int is_union, is_in_function = 0;
+    CursorRecursion *rec, *rec_ptr;
+    int is_union, is_in_function, is_registry;
+    double t0 = 0.0;
 
+    stats.cursors++;
     range = clang_getCursorExtent(cursor);
     pos   = clang_getCursorLocation(cursor);
     str   = clang_getCursorSpelling(cursor);
     clang_tokenize(TU, range, &tokens, &n_tokens);
     clang_getSpellingLocation(pos, &file, &line, &col, &off);
-    filename = clang_getFileName(file);
-
-    memset(&rec, 0, sizeof(rec));
-    rec.kind = cursor.kind;
-    rec.allow_var_decls = 0;
-    rec.parent = (CursorRecursion *) client_data;
-    rec.parent->child_cntr++;
-    rec.tokens = tokens;
-    rec.n_tokens = get_n_tokens(tokens, n_tokens, cursor.kind, parent.kind);
-    if (cursor.kind == CXCursor_FunctionDecl)
-        rec.is_function = 1;
+
+    rec = push_cursor_recursion(cursor.kind, (CursorRecursion *) client_data);
+    rec->tokens = tokens;
+    rec->n_tokens = get_n_tokens(tokens, n_tokens, cursor.kind, parent.kind);
     if (parent.kind == CXCursor_CompoundStmt)
-        rec.parent->allow_var_decls &= cursor.kind == CXCursor_DeclStmt;
+        rec->parent->allow_var_decls &= cursor.kind == CXCursor_DeclStmt;
+    is_in_function = rec->parent->function != NULL;
 
-    rec_ptr = (CursorRecursion *) client_data;
-    while (rec_ptr) {
-        if (rec_ptr->is_function) {
-            is_in_function = 1;
-            break;
-        }
-        rec_ptr = rec_ptr->parent;
-    }
+    trace(TRACE_CURSOR, cursor.kind, off, n_tokens, parent.kind);
 
-    if (DEBUG_LEVEL > 1) {
-        CXString c_spelling = clang_getCursorKindSpelling(cursor.kind);
-        CXString pc_spelling = clang_getCursorKindSpelling(parent.kind);
-        dprintf("DERP: kind=%s [pkind=%s:child_cntr=%d] %s @ %d:%d in %s\n", clang_getCString(c_spelling), clang_getCString(pc_spelling),
-                rec.parent->child_cntr, clang_getCString(str), line, col,
-                clang_getCString(filename));
-        clang_disposeString(c_spelling);
-        clang_disposeString(pc_spelling);
-        for (i = 0; i < n_tokens; i++) {
-            CXString spelling = clang_getTokenSpelling(TU, tokens[i]);
-            CXSourceLocation l = clang_getTokenLocation(TU, tokens[i]);
-            clang_getSpellingLocation(l, &file, &line, &col, &off);
-            dprintf("token = '%s' @ %d:%d\n", clang_getCString(spelling), line, col);
-            clang_disposeString(spelling);
-        }
-    }
+    // nested declarations are part of the outermost one's registry time
+    is_registry = cursor.kind == CXCursor_TypedefDecl ||
+                  cursor.kind == CXCursor_StructDecl ||
+                  cursor.kind == CXCursor_UnionDecl ||
+                  cursor.kind == CXCursor_EnumDecl;
+    if (is_registry && !stats.registry_depth++)
+        t0 = stats_time();
 
     switch (cursor.kind) {
     case CXCursor_TypedefDecl: {
         TypedefDeclaration decl;
+        if (registry_frozen)
+            break;
         memset(&decl, 0, sizeof(decl));
         decl.struct_decl_idx = (unsigned) -1;
         decl.enum_decl_idx = (unsigned) -1;
-        rec.data.td_decl = &decl;
-        clang_visitChildren(cursor, callback, &rec);
-        register_typedef(clang_getCString(str), tokens, n_tokens,
-                         &decl, cursor);
+        rec->data.td_decl = &decl;
+        clang_visitChildren(cursor, callback, rec);
+        register_typedef(clang_getCString(str), tokens, n_tokens, &decl);
         break;
     }
     case CXCursor_StructDecl:
@@ -1465,13 +3451,13 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
         is_union = cursor.kind == CXCursor_UnionDecl;
         if (parent.kind == CXCursor_TypedefDecl) {
             register_struct(clang_getCString(str), cursor,
-                            rec.parent->data.td_decl, is_union);
+                            rec->parent->data.td_decl, is_union);
         } else if (parent.kind == CXCursor_VarDecl) {
             TypedefDeclaration td;
             memset(&td, 0, sizeof(td));
             td.struct_decl_idx = (unsigned) -1;
             register_struct(clang_getCString(str), cursor, &td, is_union);
-            rec.parent->data.var_decl_data.struct_decl_idx = td.struct_decl_idx;
+            rec->parent->data.var_decl_data.struct_decl_idx = td.struct_decl_idx;
         } else {
             register_struct(clang_getCString(str), cursor, NULL, is_union);
         }
@@ -1479,20 +3465,23 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
     case CXCursor_EnumDecl:
         register_enum(clang_getCString(str), cursor,
                       parent.kind == CXCursor_TypedefDecl ?
-                            rec.parent->data.td_decl : NULL);
+                            rec->parent->data.td_decl : NULL);
         break;
     case CXCursor_TypeRef: {
         if (parent.kind == CXCursor_VarDecl &&
-            rec.parent->data.var_decl_data.struct_decl_idx == (unsigned) -1) {
+            rec->parent->data.var_decl_data.struct_decl_idx == (unsigned) -1) {
             const char *cstr = clang_getCString(str);
             unsigned idx = find_struct_decl_idx_for_type_name(cstr);
-            rec.parent->data.var_decl_data.struct_decl_idx = idx;
+            rec->parent->data.var_decl_data.struct_decl_idx = idx;
         }
         break;
     }
     case CXCursor_DeclStmt:
-        if (parent.kind != CXCursor_CompoundStmt ||
-            !rec.parent->allow_var_decls) {
+        if (parent.kind == CXCursor_CompoundStmt ?
+                !rec->parent->allow_var_decls &&
+                (rewrites & REWRITE_MIXED_DECLS) :
+                parent.kind != CXCursor_ForStmt ||
+                (rewrites & REWRITE_LOOP_DECLS)) {
             // e.g. void function() { int x; function(); int y; ... }
             //                                           ^^^^^^
             CompoundLiteralList *l;
@@ -1510,10 +3499,10 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
             }
             l = &comp_literal_lists[n_comp_literal_lists++];
             memset(l, 0, sizeof(*l));
-            clang_visitChildren(cursor, callback, &rec);
-            analyze_decl_context(l, &rec);
+            clang_visitChildren(cursor, callback, rec);
+            analyze_decl_context(l, rec);
         } else {
-            clang_visitChildren(cursor, callback, &rec);
+            clang_visitChildren(cursor, callback, rec);
         }
         break;
     case CXCursor_VarDecl: {
@@ -1521,14 +3510,18 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
         //      ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
         unsigned idx = find_struct_decl_idx(clang_getCString(str),
                                             tokens, n_tokens,
-                                            &rec.data.var_decl_data.array_depth);
-        rec.data.var_decl_data.struct_decl_idx = idx;
-        clang_visitChildren(cursor, callback, &rec);
+                                            &rec->data.var_decl_data.array_depth);
+        rec->data.var_decl_data.struct_decl_idx = idx;
+        clang_visitChildren(cursor, callback, rec);
         break;
     }
     case CXCursor_CompoundLiteralExpr: {
         CompoundLiteralList *l;
 
+        if (!(rewrites & REWRITE_COMPOUND_LITERALS)) {
+            clang_visitChildren(cursor, callback, rec);
+            break;
+        }
         if (n_comp_literal_lists == n_allocated_comp_literal_lists) {
             unsigned num = n_allocated_comp_literal_lists + 16;
             void *mem = realloc(comp_literal_lists,
@@ -1542,26 +3535,28 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
         }
         l = &comp_literal_lists[n_comp_literal_lists++];
         memset(l, 0, sizeof(*l));
-        rec.data.cl_idx = n_comp_literal_lists - 1;
+        rec->data.cl_idx = n_comp_literal_lists - 1;
         l->cast_token.start = get_token_offset(tokens[0]);
         l->struct_decl_idx = (unsigned) -1;
-        clang_visitChildren(cursor, callback, &rec);
-        analyze_compound_literal_lineage(l, &rec);
+        trace(TRACE_COMP_LITERAL, 0, rec->data.cl_idx, l->cast_token.start, 0);
+        clang_visitChildren(cursor, callback, rec);
+        analyze_compound_literal_lineage(l, rec);
         break;
     }
     case CXCursor_InitListExpr:
-        if (parent.kind == CXCursor_CompoundLiteralExpr) {
-            CompoundLiteralList *l = &comp_literal_lists[rec.parent->data.cl_idx];
+        if (parent.kind == CXCursor_CompoundLiteralExpr &&
+            (rewrites & REWRITE_COMPOUND_LITERALS)) {
+            CompoundLiteralList *l = &comp_literal_lists[rec->parent->data.cl_idx];
 
             // (type) { val }
             //        ^^^^^^^
             l->value_token.start = get_token_offset(tokens[0]);
             l->value_token.end   = get_token_offset(tokens[n_tokens - 2]);
             if (!l->cast_token.end) {
-                for (i = 0; i < rec.parent->n_tokens - 1; i++) {
+                for (i = 0; i < rec->parent->n_tokens - 1; i++) {
                     CXString spelling = clang_getTokenSpelling(TU,
-                                                        rec.parent->tokens[i]);
-                    unsigned off = get_token_offset(rec.parent->tokens[i]);
+                                                        rec->parent->tokens[i]);
+                    unsigned off = get_token_offset(rec->parent->tokens[i]);
                     int res = strcmp(clang_getCString(spelling), "[");
                     clang_disposeString(spelling);
                     if (!res)
@@ -1575,7 +3570,9 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
                     l->cast_token_array_start = l->cast_token.end;
             }
         }
-        {
+        if (!(rewrites & REWRITE_DESIGNATED_INITS)) {
+            clang_visitChildren(cursor, callback, rec);
+        } else {
             // another { val } or { .member = val } or { [index] = val }
             StructArrayList *l;
             unsigned parent_idx = (unsigned) -1;
@@ -1599,27 +3596,34 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
             l->convert_to_assignment = 0;
             l->value_offset.start = get_token_offset(tokens[0]);
             l->value_offset.end   = get_token_offset(tokens[n_tokens - 2]);
-            if (rec.parent->kind == CXCursor_VarDecl) {
-                l->struct_decl_idx = rec.parent->data.var_decl_data.struct_decl_idx;
-                l->array_depth     = rec.parent->data.var_decl_data.array_depth;
+            if (rec->parent->kind == CXCursor_VarDecl) {
+                l->struct_decl_idx = rec->parent->data.var_decl_data.struct_decl_idx;
+                l->array_depth     = rec->parent->data.var_decl_data.array_depth;
                 l->level = 0;
-            } else if (rec.parent->kind == CXCursor_CompoundLiteralExpr) {
-                CompoundLiteralList *cl = &comp_literal_lists[rec.parent->data.cl_idx];
+                trace(TRACE_INIT_LIST, TRACE_FROM_VAR_DECL, n_struct_array_lists - 1,
+                      l->value_offset.start, l->struct_decl_idx);
+            } else if (rec->parent->kind == CXCursor_CompoundLiteralExpr) {
+                CompoundLiteralList *cl = &comp_literal_lists[rec->parent->data.cl_idx];
                 get_comp_literal_type_info(l, cl,
-                                           rec.parent->tokens,
-                                           rec.parent->n_tokens,
+                                           rec->parent->tokens,
+                                           rec->parent->n_tokens,
                                            l->value_offset.start,
                                            l->value_offset.end);
+                trace(TRACE_INIT_LIST, TRACE_FROM_COMP_LITERAL,
+                      n_struct_array_lists - 1, l->value_offset.start,
+                      l->struct_decl_idx);
             } else {
                 StructArrayList *parent;
                 unsigned depth;
                 unsigned idx = find_encompassing_struct_decl(l->value_offset.start,
                                                              l->value_offset.end,
-                                                             &parent, &rec,
+                                                             &parent, rec,
                                                              &depth);
                 l->level = parent ? parent->level + 1 : 0;
                 l->struct_decl_idx = idx;
                 l->array_depth = depth;
+                trace(TRACE_INIT_LIST, TRACE_FROM_ENCLOSING_LIST,
+                      n_struct_array_lists - 1, l->value_offset.start, idx);
 
                 // If the parent is an InitListExpr also, we increment the
                 // parent l->n_entries to keep track of the number (and thus
@@ -1628,7 +3632,7 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
                 // E.g. { var, { var2, var3 }, var4 }
                 //      ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ <- parent
                 //             ^^^^^^^^^^^^^^         <- cursor
-                if (rec.parent->kind == CXCursor_InitListExpr && parent) {
+                if (rec->parent->kind == CXCursor_InitListExpr && parent) {
                     unsigned s = l->value_offset.start;
                     unsigned e = l->value_offset.end;
                     StructArrayItem *sai;
@@ -1652,28 +3656,26 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
                     sai->expression_offset.end   = e;
                     sai->index = parent->n_entries > 0 ?
                                  parent->entries[parent->n_entries - 1].index + 1 :
-                                 rec.parent->child_cntr - 1;
+                                 rec->parent->child_cntr - 1;
                     parent_idx = parent - struct_array_lists;
                 }
             }
 
-            rec.data.sal_idx = n_struct_array_lists - 1;
-            clang_visitChildren(cursor, callback, &rec);
-            if (rec.parent->kind == CXCursor_InitListExpr &&
+            rec->data.sal_idx = n_struct_array_lists - 1;
+            clang_visitChildren(cursor, callback, rec);
+            if (rec->parent->kind == CXCursor_InitListExpr &&
                 parent_idx != (unsigned) -1) {
                 struct_array_lists[parent_idx].n_entries++;
             }
-            l = &struct_array_lists[rec.data.sal_idx];
+            l = &struct_array_lists[rec->data.sal_idx];
             if (l->convert_to_assignment &&
-                rec.parent->kind == CXCursor_VarDecl) {
+                rec->parent->kind == CXCursor_VarDecl) {
                 l->value_offset.start -= 2; // Swallow the assignment character
                 l->value_offset.end   += 1; // Swallow the final semicolon
-                free(l->name);
-                l->name = find_variable_name(rec.parent);
-                rec_ptr = (CursorRecursion *) client_data;
-                while (rec_ptr->kind != CXCursor_CompoundStmt)
-                    rec_ptr = rec_ptr->parent;
-                if (rec_ptr->kind != CXCursor_CompoundStmt) {
+                l->name = find_variable_name(rec->parent);
+                trace(TRACE_ASSIGNMENT, 0, rec->data.sal_idx, 0, 0);
+                rec_ptr = rec->parent->compound;
+                if (!rec_ptr) {
                     fprintf(stderr, "Unable to find enclosing compound statement\n");
                     exit(1);
                 }
@@ -1683,12 +3685,13 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
         }
         break;
     case CXCursor_UnexposedExpr:
-        if (parent.kind == CXCursor_InitListExpr) {
+        if (parent.kind == CXCursor_InitListExpr &&
+            (rewrites & REWRITE_DESIGNATED_INITS)) {
             CXString spelling = clang_getTokenSpelling(TU, tokens[0]);
             CXString spelling2 = clang_getTokenSpelling(TU, tokens[1]);
             const char *istr = clang_getCString(spelling);
             const char *istr2 = clang_getCString(spelling2);
-            StructArrayList *l = &struct_array_lists[rec.parent->data.sal_idx];
+            StructArrayList *l = &struct_array_lists[rec->parent->data.sal_idx];
             StructArrayItem *sai;
 
             if (!strcmp(istr, "[") || !strcmp(istr, ".") || !strcmp(istr2, ":")) {
@@ -1738,24 +3741,27 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
                 sai->value_offset.start = get_token_offset(tokens[0]);
             }
             sai->value_offset.end   = get_token_offset(tokens[n_tokens - 2]);
-            rec.data.sal_idx = rec.parent->data.sal_idx;
-            clang_visitChildren(cursor, callback, &rec);
-            assert(index_is_unique(&struct_array_lists[rec.parent->data.sal_idx],
+            rec->data.sal_idx = rec->parent->data.sal_idx;
+            clang_visitChildren(cursor, callback, rec);
+            trace(TRACE_INIT_ENTRY, l->type, rec->parent->data.sal_idx,
+                  sai->expression_offset.start, sai->index);
+            assert(index_is_unique(&struct_array_lists[rec->parent->data.sal_idx],
                                    sai->index));
-            struct_array_lists[rec.parent->data.sal_idx].n_entries++;
+            struct_array_lists[rec->parent->data.sal_idx].n_entries++;
             clang_disposeString(spelling);
             clang_disposeString(spelling2);
         } else {
-            clang_visitChildren(cursor, callback, &rec);
+            clang_visitChildren(cursor, callback, rec);
         }
         break;
     case CXCursor_MemberRef:
         if (parent.kind == CXCursor_UnexposedExpr &&
-            rec.parent->parent->kind == CXCursor_InitListExpr) {
+            rec->parent->parent->kind == CXCursor_InitListExpr &&
+            (rewrites & REWRITE_DESIGNATED_INITS)) {
             // designated initializer (struct)
             // .member = val
             //  ^^^^^^
-            StructArrayList *l = &struct_array_lists[rec.parent->data.sal_idx];
+            StructArrayList *l = &struct_array_lists[rec->parent->data.sal_idx];
             StructArrayItem *sai = &l->entries[l->n_entries];
             const char *member = clang_getCString(str);
 
@@ -1764,14 +3770,15 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
             assert(l->struct_decl_idx != (unsigned) -1);
             sai->index = find_member_index_in_struct(&structs[l->struct_decl_idx],
                                                      member);
-            if (structs[l->struct_decl_idx].is_union && is_in_function)
+            if (structs[l->struct_decl_idx].is_union && is_in_function &&
+                (rewrites & REWRITE_UNION_INITS))
                 l->convert_to_assignment = 1;
         }
         break;
     case CXCursor_CompoundStmt:
-        rec.allow_var_decls = 1;
-        clang_visitChildren(cursor, callback, &rec);
-        if (rec.end_scopes) {
+        rec->allow_var_decls = 1;
+        clang_visitChildren(cursor, callback, rec);
+        if (rec->end_scopes) {
             EndScope *e;
             if (n_end_scopes == n_allocated_end_scopes) {
                 unsigned num = n_allocated_end_scopes + 16;
@@ -1786,44 +3793,46 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
             }
             e = &end_scopes[n_end_scopes++];
             e->end = get_token_offset(tokens[n_tokens - 2]);
-            e->n_scopes = rec.end_scopes;
+            e->n_scopes = rec->end_scopes;
+            trace(TRACE_END_SCOPE, 0, e->end, e->n_scopes, 0);
         }
         break;
     case CXCursor_IntegerLiteral:
     case CXCursor_DeclRefExpr:
     case CXCursor_BinaryOperator:
         if (parent.kind == CXCursor_UnexposedExpr &&
-            rec.parent->parent->kind == CXCursor_InitListExpr) {
+            rec->parent->parent->kind == CXCursor_InitListExpr &&
+            (rewrites & REWRITE_DESIGNATED_INITS)) {
             CXString spelling = clang_getTokenSpelling(TU, tokens[n_tokens - 1]);
             if (!strcmp(clang_getCString(spelling), "]")) {
                 // [index] = { val }
                 //  ^^^^^
-                FillEnumMemberCache cache;
-                StructArrayList *l = &struct_array_lists[rec.parent->data.sal_idx];
+                StructArrayList *l = &struct_array_lists[rec->parent->data.sal_idx];
                 StructArrayItem *sai = &l->entries[l->n_entries];
 
-                memset(&cache, 0, sizeof(cache));
-                fill_enum_value(cursor, parent, &cache);
-                assert(cache.n[0] == 1);
                 assert(sai);
                 assert(l->type == TYPE_ARRAY);
-                sai->index = cache.n[1];
+                sai->index = (unsigned) evaluate_integer_constant(cursor);
             }
             clang_disposeString(spelling);
         } else if (cursor.kind != CXCursor_BinaryOperator)
             break;
     default:
-        clang_visitChildren(cursor, callback, &rec);
+        clang_visitChildren(cursor, callback, rec);
         break;
     }
 
+    if (is_registry && !--stats.registry_depth)
+        stats_lap(PHASE_REGISTRY, t0);
+
     // default list filler for scalar (non-list) value types
-    if (rec.parent->kind == CXCursor_InitListExpr &&
+    if (rec->parent->kind == CXCursor_InitListExpr &&
+        (rewrites & REWRITE_DESIGNATED_INITS) &&
         cursor.kind != CXCursor_InitListExpr &&
         cursor.kind != CXCursor_UnexposedExpr) {
         unsigned s = get_token_offset(tokens[0]);
         StructArrayItem *sai;
-        StructArrayList *parent = &struct_array_lists[rec.parent->data.sal_idx];
+        StructArrayList *parent = &struct_array_lists[rec->parent->data.sal_idx];
 
         if (parent != NULL) {
             if (parent->n_entries == parent->n_allocated_entries) {
@@ -1845,162 +3854,890 @@ static enum CXChildVisitResult callback(CXCursor cursor, CXCursor parent,
             sai->expression_offset.end   = s;
             sai->index = parent->n_entries > 0 ?
                          parent->entries[parent->n_entries - 1].index + 1 :
-                         rec.parent->child_cntr - 1;
+                         rec->parent->child_cntr - 1;
+            trace(TRACE_FILLER, 0, rec->parent->data.sal_idx, s, sai->index);
             assert(index_is_unique(parent, sai->index));
             parent->n_entries++;
         }
     }
 
-    clang_disposeString(str);
-    clang_disposeTokens(TU, tokens, n_tokens);
-    clang_disposeString(filename);
+    clang_disposeString(str);
+    clang_disposeTokens(TU, tokens, n_tokens);
+    pop_cursor_recursion();
+
+    return CXChildVisit_Continue;
+}
+
+/*
+ * Printing works on a copy of the tokens' spellings and positions rather
+ * than on libclang tokens, so that it doesn't need libclang (which can't
+ * be used from multiple threads at once) and so that a chunk of tokens can
+ * be printed while the next one is being visited.
+ */
+typedef struct {
+    const char *spelling;
+    unsigned line, col; // starting at 0
+    unsigned offset;
+    unsigned extent;    // length of the token's source range
+} EmitToken;
+
+typedef struct {
+    EmitToken *tokens;
+    unsigned n_tokens;
+    char *spellings;
+} TokenTable;
+
+static void build_token_table(TokenTable *t, CXToken *tokens, unsigned n_tokens)
+{
+    size_t size = 0, allocated = 0;
+    unsigned n;
+
+    t->tokens = (EmitToken *) malloc(sizeof(*t->tokens) * (n_tokens + 1));
+    t->n_tokens = n_tokens;
+    t->spellings = NULL;
+    if (!t->tokens) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    for (n = 0; n < n_tokens; n++) {
+        CXString s = clang_getTokenSpelling(TU, tokens[n]);
+        const char *str = clang_getCString(s);
+        size_t len = strlen(str) + 1;
+        CXSourceRange range = clang_getTokenExtent(TU, tokens[n]);
+        CXFile file;
+        EmitToken *e = &t->tokens[n];
+
+        if (size + len > allocated) {
+            size_t num = allocated * 2 + len + 4096;
+            char *mem = (char *) realloc(t->spellings, num);
+            if (!mem) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            t->spellings = mem;
+            allocated = num;
+        }
+        memcpy(&t->spellings[size], str, len);
+        e->spelling = (const char *) (uintptr_t) size; // fixed up below
+        size += len;
+        clang_disposeString(s);
+
+        clang_getSpellingLocation(clang_getTokenLocation(TU, tokens[n]),
+                                  &file, &e->line, &e->col, &e->offset);
+        // clang starts counting at 1 for some reason
+        e->line--;
+        e->col--;
+        e->extent = range.end_int_data - range.begin_int_data;
+    }
+
+    for (n = 0; n < n_tokens; n++)
+        t->tokens[n].spelling = t->spellings + (uintptr_t) t->tokens[n].spelling;
+}
+
+static void free_token_table(TokenTable *t)
+{
+    free(t->tokens);
+    free(t->spellings);
+    t->tokens = NULL;
+    t->spellings = NULL;
+    t->n_tokens = 0;
+}
+
+/*
+ * Built-in lexer for the emission path. It produces the same table as
+ * build_token_table() does from clang_tokenize() (i.e. raw lexing, with
+ * comments and preprocessor directives as plain tokens), but straight from
+ * the input file, without going through libclang for every token. The hot
+ * loops (whitespace, identifiers, string literals) are vectorized with
+ * SSE2 or AVX2 where available.
+ *
+ * Line splices are rare in preprocessed input, so tokens containing them
+ * are re-lexed from a spliced copy of the source (see lex_spliced_token()).
+ * -lexcheck compares the output against libclang's tokens.
+ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LEX_VEC_SIZE 32
+typedef __m256i LexVec;
+#define lex_load(p)    _mm256_loadu_si256((const __m256i *) (p))
+#define lex_set1(c)    _mm256_set1_epi8(c)
+#define lex_eq(a, b)   _mm256_cmpeq_epi8(a, b)
+#define lex_gt(a, b)   _mm256_cmpgt_epi8(a, b)
+#define lex_or(a, b)   _mm256_or_si256(a, b)
+#define lex_and(a, b)  _mm256_and_si256(a, b)
+#define lex_mask(v)    ((uint32_t) _mm256_movemask_epi8(v))
+#define LEX_FULL_MASK  0xffffffffU
+#elif defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LEX_VEC_SIZE 16
+typedef __m128i LexVec;
+#define lex_load(p)    _mm_loadu_si128((const __m128i *) (p))
+#define lex_set1(c)    _mm_set1_epi8(c)
+#define lex_eq(a, b)   _mm_cmpeq_epi8(a, b)
+#define lex_gt(a, b)   _mm_cmpgt_epi8(a, b)
+#define lex_or(a, b)   _mm_or_si128(a, b)
+#define lex_and(a, b)  _mm_and_si128(a, b)
+#define lex_mask(v)    ((uint32_t) _mm_movemask_epi8(v))
+#define LEX_FULL_MASK  0xffffU
+#endif
+
+#if defined(LEX_VEC_SIZE)
+static unsigned lex_ctz(uint32_t x)
+{
+#ifdef _MSC_VER
+    unsigned long n;
+    _BitScanForward(&n, x);
+    return n;
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+static unsigned lex_clz(uint32_t x)
+{
+#ifdef _MSC_VER
+    unsigned long n;
+    _BitScanReverse(&n, x);
+    return 31 - n;
+#else
+    return __builtin_clz(x);
+#endif
+}
+
+static unsigned lex_popcount(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    return (((x + (x >> 4)) & 0x0f0f0f0fU) * 0x01010101U) >> 24;
+}
+#endif
+
+/* Language options for lex_tokens(), matching those of the parse. */
+enum {
+    LEX_OPT_C99        = 1 << 0, // digraphs, hex floats; not in gnu89
+    LEX_OPT_MS_EXT     = 1 << 1, // -fms-extensions
+    LEX_OPT_COLONCOLON = 1 << 2, // "::" is a token (see probe_coloncolon())
+};
+
+typedef struct {
+    const char *start, *end;
+    unsigned line;          // starting at 0
+    const char *line_start;
+    unsigned opts;
+} Lexer;
+
+static int lex_is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+           c == '\v' || c == '\f';
+}
+
+static int lex_is_ident(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_' || c == '$' ||
+           (unsigned char) c >= 0x80;
+}
+
+/*
+ * Returns the size of the line splice at p, or 0. Like clang, this allows
+ * whitespace between the backslash and the newline, and takes "\r\n" and
+ * "\n\r" as one newline.
+ */
+static size_t lex_splice_size(const char *p, const char *end)
+{
+    const char *q = p + 1;
+
+    if (p >= end || *p != '\\')
+        return 0;
+    while (q < end && (*q == ' ' || *q == '\t' || *q == '\v' || *q == '\f'))
+        q++;
+    if (q == end || (*q != '\n' && *q != '\r'))
+        return 0;
+    if (q + 1 < end && (q[1] == '\n' || q[1] == '\r') && q[1] != *q)
+        q++;
+
+    return q + 1 - p;
+}
+
+static const char *lex_skip_splices(const char *p, const char *end)
+{
+    size_t n;
+
+    while ((n = lex_splice_size(p, end)))
+        p += n;
+
+    return p;
+}
+
+/*
+ * Accounts for the line breaks in [p, e): '\n', '\r' or, like in clang,
+ * "\r\n".
+ */
+static void lex_count_lines(Lexer *l, const char *p, const char *e)
+{
+#if defined(LEX_VEC_SIZE)
+    while (e - p > LEX_VEC_SIZE) {
+        LexVec v = lex_load(p);
+        uint32_t nl = lex_mask(lex_eq(v, lex_set1('\n')));
+        uint32_t cr = lex_mask(lex_eq(v, lex_set1('\r')));
+        uint32_t next_nl = (nl >> 1) |
+            ((uint32_t) (p[LEX_VEC_SIZE] == '\n') << (LEX_VEC_SIZE - 1));
+        uint32_t breaks = nl | (cr & ~next_nl);
+        if (breaks) {
+            l->line += lex_popcount(breaks);
+            l->line_start = p + (31 - lex_clz(breaks)) + 1;
+        }
+        p += LEX_VEC_SIZE;
+    }
+#endif
+    for (; p < e; p++) {
+        // "\r\n" is counted at its '\n', which may be past e
+        if (*p == '\n' || (*p == '\r' && (p + 1 == l->end || p[1] != '\n'))) {
+            l->line++;
+            l->line_start = p + 1;
+        }
+    }
+}
+
+static const char *lex_skip_space(Lexer *l, const char *p)
+{
+    const char *s = p;
+
+#if defined(LEX_VEC_SIZE)
+    while (l->end - p >= LEX_VEC_SIZE) {
+        LexVec v = lex_load(p);
+        LexVec ws = lex_or(lex_or(lex_eq(v, lex_set1(' ')),
+                                  lex_eq(v, lex_set1('\t'))),
+                           lex_or(lex_or(lex_eq(v, lex_set1('\n')),
+                                         lex_eq(v, lex_set1('\r'))),
+                                  lex_or(lex_eq(v, lex_set1('\v')),
+                                         lex_eq(v, lex_set1('\f')))));
+        uint32_t other = ~lex_mask(ws) & LEX_FULL_MASK;
+        if (other) {
+            p += lex_ctz(other);
+            break;
+        }
+        p += LEX_VEC_SIZE;
+    }
+#endif
+    while (p < l->end && lex_is_space(*p))
+        p++;
+    lex_count_lines(l, s, p);
+
+    return p;
+}
+
+static const char *lex_ident_end(const char *p, const char *end)
+{
+#if defined(LEX_VEC_SIZE)
+    while (end - p >= LEX_VEC_SIZE) {
+        LexVec v = lex_load(p);
+        LexVec lower = lex_and(lex_gt(v, lex_set1('a' - 1)),
+                               lex_gt(lex_set1('z' + 1), v));
+        LexVec upper = lex_and(lex_gt(v, lex_set1('A' - 1)),
+                               lex_gt(lex_set1('Z' + 1), v));
+        LexVec digit = lex_and(lex_gt(v, lex_set1('0' - 1)),
+                               lex_gt(lex_set1('9' + 1), v));
+        LexVec other = lex_or(lex_or(lex_eq(v, lex_set1('_')),
+                                     lex_eq(v, lex_set1('$'))),
+                              lex_gt(lex_set1(0), v)); // bytes >= 0x80
+        uint32_t rest = ~lex_mask(lex_or(lex_or(lower, upper),
+                                         lex_or(digit, other))) & LEX_FULL_MASK;
+        if (rest)
+            return p + lex_ctz(rest);
+        p += LEX_VEC_SIZE;
+    }
+#endif
+    while (p < end && lex_is_ident(*p))
+        p++;
+
+    return p;
+}
+
+/* p points after the opening quote; returns the end of the literal. */
+static const char *lex_quoted_end(const char *p, const char *end, char quote)
+{
+    for (;;) {
+#if defined(LEX_VEC_SIZE)
+        while (end - p >= LEX_VEC_SIZE) {
+            LexVec v = lex_load(p);
+            uint32_t stop = lex_mask(lex_or(lex_or(lex_eq(v, lex_set1(quote)),
+                                                   lex_eq(v, lex_set1('\\'))),
+                                            lex_or(lex_eq(v, lex_set1('\n')),
+                                                   lex_eq(v, lex_set1('\r')))));
+            if (stop) {
+                p += lex_ctz(stop);
+                break;
+            }
+            p += LEX_VEC_SIZE;
+        }
+#endif
+        while (p < end && *p != quote && *p != '\\' &&
+               *p != '\n' && *p != '\r')
+            p++;
+        if (p == end || *p == '\n' || *p == '\r')
+            return p; // unterminated, like clang's unknown token
+        if (*p == quote)
+            return p + 1;
+        if (lex_splice_size(p, end)) {
+            p = lex_skip_splices(p, end);
+            continue;
+        }
+        // escape; the escaped character may follow a splice, too
+        p = lex_skip_splices(p + 1, end);
+        if (p < end && *p != '\n' && *p != '\r')
+            p++;
+    }
+}
+
+/*
+ * Like clang, this allows a sign after 'p' only in C99 or in hex numbers,
+ * and with -fms-extensions, not after 'e' in hex numbers.
+ */
+static const char *lex_number_end(const Lexer *l, const char *start,
+                                  const char *end)
+{
+    const char *p = start + 1;
+    int hex = start[0] == '0' && p < end && (*p == 'x' || *p == 'X');
+
+    while (p < end) {
+        if (*p == '+' || *p == '-') {
+            if ((p[-1] == 'e' || p[-1] == 'E') &&
+                !(hex && (l->opts & LEX_OPT_MS_EXT)))
+                p++;
+            else if ((p[-1] == 'p' || p[-1] == 'P') &&
+                     (hex || (l->opts & LEX_OPT_C99)))
+                p++;
+            else
+                break;
+        } else if ((lex_is_ident(*p) && *p != '$') || *p == '.') {
+            p++;
+        } else {
+            break;
+        }
+    }
+
+    return p;
+}
+
+static const char *lex_punct_end(const Lexer *l, const char *p,
+                                 const char *end)
+{
+    static const char *puncts[] = {
+        "...", "<<=", ">>=",
+        "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||",
+        "*=", "/=", "%=", "+=", "-=", "&=", "^=", "|=", "##",
+    };
+    static const char *digraphs[] = {
+        "%:%:", "<:", ":>", "<%", "%>", "%:",
+    };
+    unsigned n;
+
+    // no digraph shares more than its first character with a punctuator
+    for (n = 0; (l->opts & LEX_OPT_C99) &&
+                n < sizeof(digraphs) / sizeof(digraphs[0]); n++) {
+        size_t len = strlen(digraphs[n]);
+        if ((size_t) (end - p) >= len && !memcmp(p, digraphs[n], len))
+            return p + len;
+    }
+    for (n = 0; n < sizeof(puncts) / sizeof(puncts[0]); n++) {
+        size_t len = strlen(puncts[n]);
+        if ((size_t) (end - p) >= len && !memcmp(p, puncts[n], len))
+            return p + len;
+    }
+    if ((l->opts & LEX_OPT_COLONCOLON) && end - p >= 2 && p[0] == ':' &&
+        p[1] == ':')
+        return p + 2;
+
+    return p + 1;
+}
+
+/*
+ * Returns the end of the token starting at p, or NULL for an unterminated
+ * block comment.
+ */
+static const char *lex_token_end(const Lexer *l, const char *p,
+                                 const char *end)
+{
+    char c = *p;
+
+    if (c == '/' && p + 1 < end && p[1] == '*') {
+        const char *e = p + 2;
+        for (;;) {
+            e = (const char *) memchr(e, '*', end - e);
+            if (!e)
+                return NULL;
+            e = lex_skip_splices(e + 1, end);
+            if (e < end && *e == '/')
+                return e + 1;
+        }
+    }
+    if (c == '/' && p + 1 < end && p[1] == '/') {
+        const char *e = p + 2;
+        for (;;) {
+            const char *bs;
+            while (e < end && *e != '\n' && *e != '\r')
+                e++;
+            if (e == end)
+                return e;
+            // a line splice continues the comment
+            for (bs = e - 1; *bs == ' ' || *bs == '\t' || *bs == '\v' ||
+                             *bs == '\f'; bs--) ;
+            if (*bs != '\\')
+                return e;
+            e = bs + lex_splice_size(bs, end);
+        }
+    }
+    if (c == 'L' || c == 'U' || c == 'u') {
+        const char *q = p + 1;
+        if (c == 'u' && q < end && *q == '8')
+            q++;
+        if (q < end && (*q == '"' || (*q == '\'' && q == p + 1)))
+            return lex_quoted_end(q + 1, end, *q);
+    }
+    if (c >= '0' && c <= '9')
+        return lex_number_end(l, p, end);
+    if (c == '.' && p + 1 < end && p[1] >= '0' && p[1] <= '9')
+        return lex_number_end(l, p, end);
+    if (lex_is_ident(c))
+        return lex_ident_end(p + 1, end);
+    if (c == '"' || c == '\'')
+        return lex_quoted_end(p + 1, end, c);
+
+    return lex_punct_end(l, p, end);
+}
+
+/*
+ * Copies the spelling of the token [p, e) to dst; returns its length.
+ * libclang only removes line splices from identifiers and keywords, and
+ * returns the raw source text of all other tokens.
+ */
+static size_t lex_copy_spelling(char *dst, const char *p, const char *e)
+{
+    char *d = dst;
+    const char *q = lex_skip_splices(p, e);
+    size_t n;
+
+    if (!memchr(p, '\\', e - p) || !lex_is_ident(*q) ||
+        (*q >= '0' && *q <= '9') ||
+        memchr(p, '"', e - p) || memchr(p, '\'', e - p)) {
+        memcpy(dst, p, e - p);
+        return e - p;
+    }
+    while (p < e) {
+        if ((n = lex_splice_size(p, e))) {
+            p += n;
+            continue;
+        }
+        *d++ = *p++;
+    }
+
+    return d - dst;
+}
+
+/*
+ * Lexes a token that starts with, or continues across, a line splice, by
+ * lexing a copy of the rest of the logical line (or of the block comment)
+ * with the splices removed.
+ */
+static const char *lex_spliced_token(const Lexer *l, const char *p)
+{
+    const char *q = p, *e;
+    size_t n = 0, k, size;
+    char *clean = (char *) malloc(l->end - p);
+    unsigned *map = (unsigned *) malloc(sizeof(*map) * (l->end - p));
+
+    if (!clean || !map) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    while (q < l->end) {
+        int comment = n >= 2 && clean[0] == '/' && clean[1] == '*';
+        if ((size = lex_splice_size(q, l->end))) {
+            q += size;
+            continue;
+        }
+        if ((*q == '\n' || *q == '\r') && !comment)
+            break;
+        map[n] = (unsigned) (q - p);
+        clean[n++] = *q++;
+        if (comment && n >= 4 && clean[n - 2] == '*' && clean[n - 1] == '/')
+            break;
+    }
+    e = n ? lex_token_end(l, clean, clean + n) : clean;
+    k = e ? e - clean : 0;
+    q = !e ? NULL : k ? p + map[k - 1] + 1 : q;
+    // like clang, a line comment takes the splices before the newline
+    if (q && k >= 2 && clean[0] == '/' && clean[1] == '/')
+        q = lex_skip_splices(q, l->end);
+    free(clean);
+    free(map);
+
+    return q;
+}
+
+static EmitToken *lex_add_token(TokenTable *t, unsigned *n_allocated)
+{
+    if (t->n_tokens == *n_allocated) {
+        unsigned num = *n_allocated * 2 + 4096;
+        EmitToken *mem = (EmitToken *) realloc(t->tokens,
+                                               sizeof(*t->tokens) * (num + 1));
+        if (!mem) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        t->tokens = mem;
+        *n_allocated = num;
+    }
+
+    return &t->tokens[t->n_tokens++];
+}
+
+static void lex_tokens(TokenTable *t, const char *data, size_t len,
+                       unsigned opts)
+{
+    Lexer l;
+    const char *p = data;
+    unsigned n_allocated = 0;
+    size_t size = 0;
+
+    t->tokens = NULL;
+    t->n_tokens = 0;
+    // spellings are never longer than the source, plus a nul each
+    t->spellings = (char *) malloc(len * 2 + 1);
+    if (!t->spellings) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    lex_add_token(t, &n_allocated);
+    t->n_tokens = 0;
+
+    l.start = l.line_start = data;
+    l.end = data + len;
+    l.line = 0;
+    l.opts = opts;
+    if (len >= 3 && !memcmp(p, "\xef\xbb\xbf", 3))
+        p += 3;
+
+    for (;;) {
+        const char *e;
+        EmitToken *tok;
+
+        p = lex_skip_space(&l, p);
+        if (p == l.end)
+            break;
+        if (lex_splice_size(p, l.end)) {
+            const char *q = lex_skip_splices(p, l.end);
+            if (q == l.end || lex_is_space(*q)) {
+                // just whitespace
+                lex_count_lines(&l, p, q);
+                p = q;
+                continue;
+            }
+            e = lex_spliced_token(&l, p);
+        } else {
+            e = lex_token_end(&l, p, l.end);
+            if (e && lex_splice_size(e, l.end))
+                e = lex_spliced_token(&l, p);
+        }
+        // libclang drops an unterminated comment (and thus the rest)
+        if (!e)
+            break;
+
+        tok = lex_add_token(t, &n_allocated);
+        tok->spelling = (const char *) (uintptr_t) size; // fixed up below
+        size += lex_copy_spelling(&t->spellings[size], p, e);
+        t->spellings[size++] = 0;
+        tok->line = l.line;
+        tok->col = (unsigned) (p - l.line_start);
+        tok->offset = (unsigned) (p - data);
+        tok->extent = (unsigned) (e - p);
+        lex_count_lines(&l, p, e);
+        p = e;
+    }
+
+    for (n_allocated = 0; n_allocated < t->n_tokens; n_allocated++)
+        t->tokens[n_allocated].spelling =
+            t->spellings + (uintptr_t) t->tokens[n_allocated].spelling;
+}
+
+/* Builds the token table for file with the built-in lexer. */
+static int lex_file(TokenTable *t, const char *file, unsigned opts)
+{
+    size_t size = 0;
+    void *map = map_file(file, &size);
+
+    if (!map) {
+        // an empty file can't be mapped
+        FILE *f = fopen(file, "rb");
+        if (!f)
+            return 1;
+        fclose(f);
+        lex_tokens(t, "", 0, opts);
+        return 0;
+    }
+    lex_tokens(t, (const char *) map, size, opts);
+    unmap_file(map, size);
+
+    return 0;
+}
+
+/* -lexcheck: returns 0 if the two tables are identical. */
+static int compare_token_tables(const TokenTable *a, const TokenTable *b)
+{
+    unsigned n;
+
+    for (n = 0; n < a->n_tokens && n < b->n_tokens; n++) {
+        const EmitToken *x = &a->tokens[n], *y = &b->tokens[n];
+        if (strcmp(x->spelling, y->spelling) || x->line != y->line ||
+            x->col != y->col || x->offset != y->offset ||
+            x->extent != y->extent) {
+            fprintf(stderr, "Token %u differs: '%s' @ %u:%u (offset %u, "
+                    "extent %u) vs. libclang '%s' @ %u:%u (offset %u, "
+                    "extent %u)\n", n,
+                    x->spelling, x->line + 1, x->col + 1, x->offset, x->extent,
+                    y->spelling, y->line + 1, y->col + 1, y->offset, y->extent);
+            return 1;
+        }
+    }
+    if (a->n_tokens != b->n_tokens) {
+        fprintf(stderr, "Token count differs: %u vs. libclang %u\n",
+                a->n_tokens, b->n_tokens);
+        return 1;
+    }
+
+    return 0;
+}
 
-    return CXChildVisit_Continue;
+/* A copy of the tokens at offsets [start, end) of t, sharing its spellings. */
+static void slice_token_table(TokenTable *dst, const TokenTable *t,
+                              unsigned start, unsigned end)
+{
+    unsigned lo = 0, hi = t->n_tokens, n;
+
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (t->tokens[mid].offset < start)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    for (n = lo; n < t->n_tokens && t->tokens[n].offset < end; n++) ;
+
+    dst->n_tokens = n - lo;
+    dst->spellings = NULL;
+    dst->tokens = (EmitToken *) malloc(sizeof(*dst->tokens) * (dst->n_tokens + 1));
+    if (!dst->tokens) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    memcpy(dst->tokens, &t->tokens[lo], sizeof(*dst->tokens) * dst->n_tokens);
 }
 
-static double eval_expr(CXToken *tokens, unsigned *n, unsigned last);
+/*
+ * Printer state. These are thread-local, since in threaded mode every
+ * emitter thread prints its own chunks into a buffer (out_buf) instead of
+ * directly into the output file.
+ */
+typedef struct {
+    char *data;
+    size_t size, allocated;
+} OutputBuffer;
+static THREAD_LOCAL OutputBuffer *out_buf = NULL;
+static THREAD_LOCAL int prev_l = -1;
+static THREAD_LOCAL int prev_p_end = -1;
+static THREAD_LOCAL unsigned unique_cntr = 0;
+// the struct registry, as it was when the lists being printed were complete
+static THREAD_LOCAL StructDeclaration *emit_structs = NULL;
 
-static double eval_prim(CXToken *tokens, unsigned *n, unsigned last)
+/*
+ * With -edits, the output is a JSON list of the edits that turn the input
+ * into the converted file, instead of the converted file itself. Most
+ * tokens are printed as they are in the input, so each token printed with
+ * its own spelling at an offset past the previous one ends an edit: the
+ * text printed since the previous one replaces the input in between, if
+ * it differs. Everything else printed (tmp variables, reordered entries,
+ * whitespace) is replacement text. The edits are thus sorted by offset and
+ * don't overlap. Only used without emitter threads.
+ */
+typedef struct {
+    FILE *f;
+    char *input;
+    size_t len;
+    size_t pos;           // the input before this is accounted for
+    OutputBuffer pending; // printed since pos
+    unsigned n_edits;
+} EditList;
+static EditList edit_list, *edits = NULL;
+
+static void write_output(const char *str, size_t len)
 {
-    CXString s;
-    const char *str;
-    if (*n > last) {
-        fprintf(stderr, "Unable to parse an expression primary, no more tokens\n");
-        exit(1);
+    OutputBuffer *b = out_buf ? out_buf : edits ? &edits->pending : NULL;
+
+    if (!b) {
+        fwrite(str, 1, len, out);
+        return;
     }
-    s = clang_getTokenSpelling(TU, tokens[*n]);
-    str = clang_getCString(s);
-    if (!strcmp(str, "-")) {
-        (*n)++;
-        clang_disposeString(s);
-        return -eval_prim(tokens, n, last);
-    } else if (!strcmp(str, "(")) {
-        double d;
-        (*n)++;
-        clang_disposeString(s);
-        if (*n + 1 <= last) {
-            CXString s2;
-            const char *str2;
-            s = clang_getTokenSpelling(TU, tokens[*n]);
-            str = clang_getCString(s);
-            s2 = clang_getTokenSpelling(TU, tokens[*n + 1]);
-            str2 = clang_getCString(s2);
-            // This should ideally recognize all built-in types
-            // and also check the type name against all typedefs
-            // (it also doesn't support two word typnames such as structs.
-            // This is enough for handling double casts in DBL_MAX in
-            // certain glibc versions though.
-            if (!strcmp(str2, ")") && !strcmp(str, "double")) {
-                clang_disposeString(s);
-                clang_disposeString(s2);
-                (*n) += 2;
-                return eval_prim(tokens, n, last);
-            }
-            clang_disposeString(s);
-            clang_disposeString(s2);
-        }
-        d = eval_expr(tokens, n, last);
-        if (*n > last) {
-            fprintf(stderr, "No right parenthesis found\n");
-            exit(1);
-        }
-        s = clang_getTokenSpelling(TU, tokens[*n]);
-        str = clang_getCString(s);
-        if (!strcmp(str, ")")) {
-            clang_disposeString(s);
-            (*n)++;
-        } else {
-            fprintf(stderr, "No right parenthesis found\n");
-            exit(1);
-        }
-        return d;
-    } else {
-        char *end;
-        double d;
-        if (str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) {
-            d = strtoll(str, &end, 16);
-        } else {
-            d = strtod(str, &end);
-        }
-        // Handle a possible f suffix for float constants
-        if (end != str && (*end == 'f' || *end == 'F'))
-            end++;
-        // Handle a possible l suffix for int constants
-        while (end != str && (*end == 'l' || *end == 'L'))
-            end++;
-        if (*end != '\0') {
-            fprintf(stderr, "Unable to parse %s as expression primary\n", str);
+    if (b->size + len > b->allocated) {
+        size_t num = b->allocated * 2 + len + 4096;
+        char *mem = (char *) realloc(b->data, num);
+        if (!mem) {
+            fprintf(stderr, "Out of memory\n");
             exit(1);
         }
-        (*n)++;
-        clang_disposeString(s);
-        return d;
+        b->data = mem;
+        b->allocated = num;
     }
+    memcpy(&b->data[b->size], str, len);
+    b->size += len;
 }
 
-static double eval_term(CXToken *tokens, unsigned *n, unsigned last)
+static void start_edits(EditList *e, FILE *f, const char *infile,
+                        char *input, size_t len)
 {
-    double left = eval_prim(tokens, n, last);
-    while (*n <= last) {
-        CXString s = clang_getTokenSpelling(TU, tokens[*n]);
-        const char *str = clang_getCString(s);
-        if (!strcmp(str, "*")) {
-            (*n)++;
-            left *= eval_prim(tokens, n, last);
-        } else if (!strcmp(str, "/")) {
-            (*n)++;
-            left /= eval_prim(tokens, n, last);
-        } else {
-            clang_disposeString(s);
-            return left;
-        }
-        clang_disposeString(s);
-    }
-    return left;
+    free(e->input);
+    e->f = f;
+    e->input = input;
+    e->len = len;
+    e->pos = 0;
+    e->pending.size = 0;
+    e->n_edits = 0;
+    fprintf(f, "{\"input\": ");
+    print_json_string(f, infile);
+    fprintf(f, ", \"size\": %lu, \"edits\": [", (unsigned long) len);
 }
 
-static double eval_expr(CXToken *tokens, unsigned *n, unsigned last)
+/* Replaces the input from edits->pos up to upto with the pending text */
+static void flush_edit(size_t upto)
 {
-    double left = eval_term(tokens, n, last);
-    while (*n <= last) {
-        CXString s = clang_getTokenSpelling(TU, tokens[*n]);
-        const char *str = clang_getCString(s);
-        if (!strcmp(str, "-")) {
-            (*n)++;
-            left -= eval_term(tokens, n, last);
-        } else if (!strcmp(str, "+")) {
-            (*n)++;
-            left += eval_term(tokens, n, last);
-        } else {
-            clang_disposeString(s);
-            return left;
-        }
-        clang_disposeString(s);
+    const char *in = &edits->input[edits->pos], *text = edits->pending.data;
+    size_t len = upto - edits->pos, text_len = edits->pending.size;
+
+    // only the part that differs is replaced
+    for (; len && text_len && *in == *text; in++, text++, len--, text_len--) ;
+    for (; len && text_len && in[len - 1] == text[text_len - 1];
+         len--, text_len--) ;
+    if (len || text_len) {
+        fprintf(edits->f, "%s\n{\"offset\": %lu, \"length\": %lu, \"text\": ",
+                edits->n_edits++ ? "," : "",
+                (unsigned long) (in - edits->input), (unsigned long) len);
+        print_json_string_len(edits->f, text, text_len);
+        fputc('}', edits->f);
     }
-    return left;
+    edits->pos = upto;
+    edits->pending.size = 0;
 }
 
-static double eval_tokens(CXToken *tokens, unsigned first, unsigned last)
+static void finish_edits(void)
 {
-    unsigned n = first;
-    double d = eval_expr(tokens, &n, last);
-    if (n <= last) {
-        fprintf(stderr, "Unable to parse tokens as expression\n");
-        exit(1);
-    }
-    return d;
+    flush_edit(edits->len);
+    fprintf(edits->f, "\n]}\n");
 }
 
-static void get_token_position(CXToken token, unsigned *lnum,
+static void get_token_position(EmitToken token, unsigned *lnum,
                                unsigned *pos, unsigned *off)
 {
-    CXFile file;
-    CXSourceLocation l = clang_getTokenLocation(TU, token);
-    clang_getSpellingLocation(l, &file, lnum, pos, off);
+    *lnum = token.line;
+    *pos = token.col;
+    *off = token.offset;
+}
+
+/*
+ * For -compact: runs of empty lines are written as a #line directive
+ * instead, wherever that is shorter. The line markers of the input give
+ * the line number and file name the directive has to set, so that
+ * diagnostics and debug info still point at the original lines.
+ */
+typedef struct {
+    unsigned line;     // of the marker itself, counting from 0
+    unsigned presumed; // of the line after it
+    char *name;        // raw, as in the marker
+} LineMarker;
+static LineMarker *line_markers = NULL;
+static unsigned n_line_markers = 0;
+static unsigned n_allocated_line_markers = 0;
+static int compact = 0;
+
+static void find_line_markers(const char *data, size_t len)
+{
+    const char *p = data, *end = data + len;
+    unsigned l;
+
+    for (l = 0; p < end; l++) {
+        const char *eol = memchr(p, '\n', end - p);
+        const char *name;
+        unsigned name_len, line;
+
+        eol = eol ? eol + 1 : end;
+        if (parse_line_marker(p, eol, &name, &name_len, &line)) {
+            LineMarker *m;
+
+            if (n_line_markers == n_allocated_line_markers) {
+                unsigned num = n_allocated_line_markers * 2 + 64;
+                void *mem = realloc(line_markers, sizeof(*line_markers) * num);
+                if (!mem) {
+                    fprintf(stderr, "Out of memory\n");
+                    exit(1);
+                }
+                line_markers = (LineMarker *) mem;
+                n_allocated_line_markers = num;
+            }
+            m = &line_markers[n_line_markers++];
+            m->line = l;
+            m->presumed = line;
+            m->name = (char *) malloc(name_len + 1);
+            if (!m->name) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            memcpy(m->name, name, name_len);
+            m->name[name_len] = 0;
+        }
+        p = eol;
+    }
+}
+
+/*
+ * Called before n newlines that lead up to line l are written. Writes the
+ * #line directive for line l instead, and returns 1, if that is shorter.
+ */
+static int compact_empty_lines(unsigned l, int n)
+{
+    unsigned lo = 0, hi = n_line_markers, presumed = l + 1;
+    const char *name = NULL;
+    char buf[64];
+    int len;
+
+    if (!compact || n <= 0)
+        return 0;
+    // the last marker before line l
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (line_markers[mid].line < l)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo) {
+        name = line_markers[lo - 1].name;
+        presumed = line_markers[lo - 1].presumed + l -
+                   line_markers[lo - 1].line - 1;
+    }
+    len = snprintf(buf, sizeof(buf), "\n#line %u", presumed);
+    if (len + (name ? strlen(name) + 3 : 0) + 1 >= (unsigned) n)
+        return 0;
+    write_output(buf, len);
+    if (name) {
+        write_output(" \"", 2);
+        write_output(name, strlen(name));
+        write_output("\"", 1);
+    }
+    write_output("\n", 1);
 
-    // clang starts counting at 1 for some reason
-    (*lnum)--;
-    (*pos)--;
+    return 1;
 }
 
 #define NEW_INDENT
@@ -2014,59 +4751,61 @@ from the previous token to this one next. It might be better if this project man
 spaces would ever be emitted. Instead we now concern ourselves with preserving the relative spacing
 instead? */
 
-static void indent_for_token(CXToken token, unsigned *lnum,
+static void indent_for_token(EmitToken token, unsigned *lnum,
     unsigned *pos, unsigned *off)
 {
-    static int prev_l = -1;
-    static int prev_p_end = -1;
     unsigned l, p;
-    CXSourceRange range = clang_getTokenExtent(TU, token);
 
     get_token_position(token, &l, &p, off);
     if (prev_l != -1) {
+        if (compact_empty_lines(l, (int) l - prev_l)) {
+            *lnum += l - prev_l;
+            prev_l = l;
+            prev_p_end = -1;
+            *pos = 0;
+        }
         for (; prev_l < l; prev_l++, prev_p_end = -1, *pos = 0, (*lnum)++)
-            fprintf(out, "\n");
+            write_output("\n", 1);
     } else {
+        if (compact_empty_lines(l, (int) (l - *lnum))) {
+            *lnum = l;
+            *pos = 0;
+        }
         for (; *lnum < l; (*lnum)++, *pos = 0)
-            fprintf(out, "\n");
+            write_output("\n", 1);
     }
     if (prev_p_end != -1) {
         for (; prev_p_end < p; prev_p_end++, (*pos)++)
-            fprintf(out, " ");
+            write_output(" ", 1);
     } else {
         for (; *pos < p; (*pos)++)
-            fprintf(out, " ");
+            write_output(" ", 1);
     }
     prev_l = l;
-    prev_p_end = p + range.end_int_data - range.begin_int_data;
+    prev_p_end = p + token.extent;
 
     return;
 }
 
 #else
 
-static void indent_for_token(CXToken token, unsigned *lnum,
+static void indent_for_token(EmitToken token, unsigned *lnum,
     unsigned *pos, unsigned *off)
 {
     unsigned l, p;
     unsigned nspaces = 0;
     (void)nspaces;
 
-    if (DEBUG_LEVEL > 2) {
-        CXString s = clang_getTokenSpelling(TU, token);
-        const char * str = clang_getCString(s);
-    }
     get_token_position(token, &l, &p, off);
     for (; *lnum < l; (*lnum)++, *pos = 0)
-        fprintf(out, "\n");
+        write_output("\n", 1);
     for (; *pos < p; (*pos)++) {
-        fprintf(out, " ");
+        write_output(" ", 1);
         if (DEBUG_LEVEL > 2)
             nspaces++;
     }
     if (DEBUG_LEVEL > 2) {
-        printf("indent_for_token %s = %d (nspaces), %d:%d, *off=%d\n", str, nspaces, l, p, *off);
-        clang_disposeString(s);
+        printf("indent_for_token %s = %d (nspaces), %d:%d, *off=%d\n", token.spelling, nspaces, l, p, *off);
     }
 }
 
@@ -2075,19 +4814,31 @@ static void indent_for_token(CXToken token, unsigned *lnum,
 static void print_literal_text(const char *str, unsigned *lnum,
                                unsigned *pos)
 {
-    fprintf(out, "%s", str);
-    (*pos) += strlen(str);
+    size_t len = strlen(str);
+
+    write_output(str, len);
+    (*pos) += len;
 }
 
-static void print_token(CXToken token, unsigned *lnum,
+static void print_token(EmitToken token, unsigned *lnum,
                         unsigned *pos)
 {
-    CXString s = clang_getTokenSpelling(TU, token);
-    print_literal_text(clang_getCString(s), lnum, pos);
-    clang_disposeString(s);
+    if (edits) {
+        size_t len = strlen(token.spelling);
+
+        // kept in place, see EditList
+        if (token.offset >= edits->pos && token.offset + len <= edits->len &&
+            !memcmp(&edits->input[token.offset], token.spelling, len)) {
+            flush_edit(token.offset);
+            edits->pos += len;
+            (*pos) += len;
+            return;
+        }
+    }
+    print_literal_text(token.spelling, lnum, pos);
 }
 
-static unsigned find_token_for_offset(CXToken *tokens, unsigned n_tokens,
+static unsigned find_token_for_offset(EmitToken *tokens, unsigned n_tokens,
                                       unsigned n, unsigned off)
 {
     for (; n < n_tokens; n++) {
@@ -2135,8 +4886,11 @@ static unsigned find_index_for_level(unsigned level, unsigned index,
 
 static void reorder_compound_literal_list(unsigned n)
 {
+    double t0;
+
     if (!n_comp_literal_lists)
         return;
+    t0 = stats_time();
 
     // FIXME probably slow - quicksort?
     for (; n < n_comp_literal_lists - 1; n++) {
@@ -2158,16 +4912,18 @@ static void reorder_compound_literal_list(unsigned n)
             comp_literal_lists[n] = bak;
         }
     }
+    if (stats.enabled)
+        emit_stats.reorder += get_time() - t0;
 }
 
-static void print_token_wrapper(CXToken *tokens, unsigned n_tokens,
+static void print_token_wrapper(EmitToken *tokens, unsigned n_tokens,
                                 unsigned *n, unsigned *lnum, unsigned *cpos,
                                 unsigned *saidx, unsigned *clidx, unsigned *esidx,
                                 unsigned off);
 
 static void declare_variable(CompoundLiteralList *l, unsigned cur_tok_off,
                              unsigned *clidx, unsigned *_saidx, unsigned *esidx,
-                             CXToken *tokens, unsigned n_tokens,
+                             EmitToken *tokens, unsigned n_tokens,
                              const char *var_name, unsigned *lnum,
                              unsigned *cpos)
 {
@@ -2214,10 +4970,8 @@ static void declare_variable(CompoundLiteralList *l, unsigned cur_tok_off,
 static void replace_comp_literal(CompoundLiteralList *l,
                                  unsigned *clidx, unsigned *saidx, unsigned *esidx,
                                  unsigned *lnum, unsigned *cpos, unsigned *_n,
-                                 CXToken *tokens, unsigned n_tokens)
+                                 EmitToken *tokens, unsigned n_tokens)
 {
-    static unsigned unique_cntr = 0;
-
     if (l->type == TYPE_OMIT_CAST) {
         unsigned off;
 
@@ -2228,12 +4982,12 @@ static void replace_comp_literal(CompoundLiteralList *l,
     } else if (l->type == TYPE_TEMP_ASSIGN) {
         if (l->context.start < l->cast_token.start) {
             unsigned off;
-            char tmp[256];
+            char *tmp = l->data.t_c_d.tmp_var_name;
 
             // open a new context, so we can declare a new variable
             print_literal_text("{ ", lnum, cpos);
-            snprintf(tmp, sizeof(tmp), "tmp__%u", unique_cntr++);
-            l->data.t_c_d.tmp_var_name = strdup(tmp);
+            snprintf(tmp, sizeof(l->data.t_c_d.tmp_var_name), "tmp__%u",
+                     unique_cntr++);
             declare_variable(l, *_n, clidx, saidx, esidx,
                              tokens, n_tokens, tmp, lnum, cpos);
             print_literal_text("; ", lnum, cpos);
@@ -2252,8 +5006,7 @@ static void replace_comp_literal(CompoundLiteralList *l,
             // replace original CL with a reference to the
             // newly declared static const variable
             print_literal_text(tmp_var_name, lnum, cpos);
-            l->data.t_c_d.tmp_var_name = NULL;
-            free(tmp_var_name);
+            tmp_var_name[0] = 0;
             *_n = find_token_for_offset(tokens, n_tokens, *_n,
                                         l->value_token.end);
             get_token_position(tokens[*_n + 1], lnum, cpos, &off);
@@ -2272,15 +5025,13 @@ static void replace_comp_literal(CompoundLiteralList *l,
                 if (tok_lnum > *lnum)
                 {
                     // Get previous token spelling.
-                    CXString s = clang_getTokenSpelling(TU, tokens[*_n]);
-                    const char * spelling = clang_getCString(s);
+                    const char * spelling = tokens[*_n].spelling;
                     if (strcmp(spelling, ";") && strcmp(spelling, "}"))
                     {
                         print_literal_text("\n", lnum, cpos);
                         (*lnum)++;
                         *cpos = 0;
                     }
-                    clang_disposeString(s);
                 }
             }
 
@@ -2294,12 +5045,12 @@ static void replace_comp_literal(CompoundLiteralList *l,
     } else if (l->type == TYPE_CONST_DECL) {
         if (l->context.start < l->cast_token.start) {
             unsigned off;
-            char tmp[256];
+            char *tmp = l->data.t_c_d.tmp_var_name;
 
             // declare static const variable
             print_literal_text("static ", lnum, cpos);
-            snprintf(tmp, sizeof(tmp), "tmp__%u", unique_cntr++);
-            l->data.t_c_d.tmp_var_name = strdup(tmp);
+            snprintf(tmp, sizeof(l->data.t_c_d.tmp_var_name), "tmp__%u",
+                     unique_cntr++);
             declare_variable(l, *_n, clidx, saidx, esidx,
                              tokens, n_tokens, tmp, lnum, cpos);
             print_literal_text(";", lnum, cpos);
@@ -2318,8 +5069,7 @@ static void replace_comp_literal(CompoundLiteralList *l,
             // replace original CL with a reference to the
             // newly declared static const variable
             print_literal_text(tmp_var_name, lnum, cpos);
-            l->data.t_c_d.tmp_var_name = NULL;
-            free(tmp_var_name);
+            tmp_var_name[0] = 0;
             *_n = find_token_for_offset(tokens, n_tokens, *_n,
                                         l->value_token.end);
             get_token_position(tokens[*_n + 1], lnum, cpos, &off);
@@ -2378,16 +5128,15 @@ static void replace_comp_literal(CompoundLiteralList *l,
 
 static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *esidx,
                                  unsigned *lnum, unsigned *cpos, unsigned *_n,
-                                 CXToken *tokens, unsigned n_tokens)
+                                 EmitToken *tokens, unsigned n_tokens)
 {
     unsigned saidx = *_saidx, off, i, n = *_n, j;
     StructArrayList *sal = &struct_array_lists[saidx];
     StructDeclaration *decl = sal->struct_decl_idx != (unsigned) -1 ?
-                              &structs[sal->struct_decl_idx] : NULL;
+                              &emit_structs[sal->struct_decl_idx] : NULL;
     int is_union = decl ? decl->is_union : 0;
 
     if (sal->convert_to_assignment) {
-        CXString spelling;
         print_literal_text(";", lnum, cpos);
         for (i = 0; i < sal->n_entries; i++) {
             StructArrayItem *sai = &sal->entries[i];
@@ -2397,7 +5146,7 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
 
             print_literal_text(sal->name, lnum, cpos);
             print_literal_text(".", lnum, cpos);
-            print_literal_text(structs[sal->struct_decl_idx].entries[sai->index].name, lnum, cpos);
+            print_literal_text(emit_structs[sal->struct_decl_idx].entries[sai->index].name, lnum, cpos);
             print_literal_text("=", lnum, cpos);
             get_token_position(tokens[token_start], lnum, cpos, &off);
             for (n = token_start; n <= token_end; n++)
@@ -2412,9 +5161,7 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
 
         // adjust token index and position back
         get_token_position(tokens[n], lnum, cpos, &off);
-        spelling = clang_getTokenSpelling(TU, tokens[n]);
-        (*cpos) += strlen(clang_getCString(spelling));
-        clang_disposeString(spelling);
+        (*cpos) += strlen(tokens[n].spelling);
         return;
     }
 
@@ -2431,13 +5178,12 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
                  indent_token_end, next_indent_token_start, val_token_start,
                  val_token_end;
         int print_normal = 1;
-        CXString spelling;
         StructMember *member = decl ? &decl->entries[j] : NULL;
 
         val_idx = find_value_index(&struct_array_lists[saidx], j);
 
         assert(struct_array_lists[saidx].array_depth > 0 ||
-               j < structs[struct_array_lists[saidx].struct_decl_idx].n_entries);
+               j < emit_structs[struct_array_lists[saidx].struct_decl_idx].n_entries);
         if (val_idx == (unsigned) -1) {
             unsigned depth = struct_array_lists[saidx].array_depth;
             unsigned idx = struct_array_lists[saidx].struct_decl_idx;
@@ -2451,14 +5197,15 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
                 } else {
                     print_literal_text("0", lnum, cpos);
                 }
-            } else if ((structs[idx].entries[j].struct_decl_idx != (unsigned) -1 &&
-                        structs[idx].entries[j].n_ptrs == 0) ||
-                       structs[idx].entries[j].array_depth) {
+            } else if ((emit_structs[idx].entries[j].struct_decl_idx != (unsigned) -1 &&
+                        emit_structs[idx].entries[j].n_ptrs == 0) ||
+                       emit_structs[idx].entries[j].array_depth) {
                 print_literal_text("{ 0 }", lnum, cpos);
             } else {
                 print_literal_text("0", lnum, cpos);
             }
             print_literal_text(", ", lnum, cpos);
+            emit_stats.gap_fillers++;
             continue; // gap
         }
 
@@ -2500,7 +5247,7 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
                     double f;
                 } if64;
                 char buf[20];
-                if64.f = eval_tokens(tokens, val_token_start, val_token_end);
+                if64.f = struct_array_lists[saidx].entries[val_idx].float_value;
                 if (!strcmp(member->type, "float")) {
                     union {
                         uint32_t i;
@@ -2525,9 +5272,7 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
         // adjust token index and position back
         n = next_indent_token_start;
         get_token_position(tokens[n], lnum, cpos, &off);
-        spelling = clang_getTokenSpelling(TU, tokens[n]);
-        (*cpos) += strlen(clang_getCString(spelling));
-        clang_disposeString(spelling);
+        (*cpos) += strlen(tokens[n].spelling);
         n++;
 
         if (++i < struct_array_lists[saidx].n_entries) {
@@ -2560,7 +5305,7 @@ static void replace_struct_array(unsigned *_saidx, unsigned *_clidx, unsigned *e
     *_n = n;
 }
 
-static void print_token_wrapper(CXToken *tokens, unsigned n_tokens,
+static void print_token_wrapper(EmitToken *tokens, unsigned n_tokens,
                                 unsigned *n, unsigned *lnum, unsigned *cpos,
                                 unsigned *saidx, unsigned *clidx, unsigned *esidx,
                                 unsigned off)
@@ -2585,45 +5330,638 @@ static void print_token_wrapper(CXToken *tokens, unsigned n_tokens,
             replace_struct_array(saidx, clidx, esidx, lnum, cpos, n,
                                  tokens, n_tokens);
         }
-    } else if (*clidx < n_comp_literal_lists &&
-               off == comp_literal_lists[*clidx].context.start) {
-        if (comp_literal_lists[*clidx].type == TYPE_UNKNOWN) {
-            print_token(tokens[*n], lnum, cpos);
-        } else {
-            replace_comp_literal(&comp_literal_lists[*clidx],
-                                 clidx, saidx, esidx, lnum, cpos, n,
-                                 tokens, n_tokens);
+    } else if (*clidx < n_comp_literal_lists &&
+               off == comp_literal_lists[*clidx].context.start) {
+        if (comp_literal_lists[*clidx].type == TYPE_UNKNOWN) {
+            print_token(tokens[*n], lnum, cpos);
+        } else {
+            replace_comp_literal(&comp_literal_lists[*clidx],
+                                 clidx, saidx, esidx, lnum, cpos, n,
+                                 tokens, n_tokens);
+        }
+        while (*clidx < n_comp_literal_lists &&
+               comp_literal_lists[*clidx].type == TYPE_UNKNOWN)
+            (*clidx)++;
+    } else {
+        print_token(tokens[*n], lnum, cpos);
+    }
+
+    while (*esidx < n_end_scopes && off >= end_scopes[*esidx].end - 1) {
+        int i;
+        for (i = 0; i < end_scopes[*esidx].n_scopes; i++)
+            print_literal_text("}", lnum, cpos);
+        (*cpos) -= end_scopes[*esidx].n_scopes;
+        (*esidx)++;
+    }
+}
+
+static void print_token_range(EmitToken *tokens, unsigned first,
+                              unsigned n_tokens, unsigned *lnum, unsigned *cpos)
+{
+    unsigned n, saidx = 0, clidx = 0, esidx = 0, off;
+
+    reorder_compound_literal_list(0);
+
+    for (n = first; n < n_tokens; n++) {
+        indent_for_token(tokens[n], lnum, cpos, &off);
+        print_token_wrapper(tokens, n_tokens, &n,
+                            lnum, cpos, &saidx, &clidx, &esidx, off);
+    }
+}
+
+/*
+ * Floating point values assigned to a union member other than the first
+ * are printed as their binary representation (see replace_struct_array()).
+ * They're evaluated here, before printing, because evaluation may need the
+ * enum registry, which printing doesn't otherwise use.
+ */
+static void evaluate_union_float_values(EmitToken *tokens, unsigned n_tokens)
+{
+    unsigned n, m;
+
+    for (n = 0; n < n_struct_array_lists; n++) {
+        StructArrayList *sal = &struct_array_lists[n];
+        StructDeclaration *decl;
+        StructArrayItem *sai = NULL;
+        StructMember *member;
+        const char **spellings;
+        unsigned first, last;
+
+        if (sal->type == TYPE_IRRELEVANT || sal->convert_to_assignment ||
+            sal->struct_decl_idx == (unsigned) -1)
+            continue;
+        decl = &structs[sal->struct_decl_idx];
+        if (!decl->is_union || !decl->n_entries)
+            continue;
+
+        // unions are initialized by only one element, the lowest index
+        for (m = 0; m < sal->n_entries; m++) {
+            if (!sai || sal->entries[m].index < sai->index)
+                sai = &sal->entries[m];
+        }
+        if (!sai || sai->index == 0 || sai->index >= decl->n_entries)
+            continue;
+        member = &decl->entries[sai->index];
+        if ((strcmp(member->type, "double") && strcmp(member->type, "float")) ||
+            member->n_ptrs)
+            continue;
+        if ((!strcmp(decl->entries[0].type, "double") ||
+             !strcmp(decl->entries[0].type, "float")) && !decl->entries[0].n_ptrs)
+            continue; // can't be converted, printing will fail
+
+        first = find_token_for_offset(tokens, n_tokens, 0, sai->value_offset.start);
+        last  = find_token_for_offset(tokens, n_tokens, first, sai->value_offset.end);
+        spellings = (const char **) malloc(sizeof(*spellings) * (last - first + 1));
+        if (!spellings) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        for (m = first; m <= last; m++)
+            spellings[m - first] = tokens[m].spelling;
+        sai->float_value = constant_as_double(eval_spellings(spellings,
+                                                            last - first + 1, 0));
+        free(spellings);
+    }
+}
+
+/*
+ * Upper bound of the number of tmp__N variables that printing the current
+ * lists declares, so that chunks printed in parallel can number their
+ * variables as if they had been printed in order.
+ */
+static unsigned count_tmp_vars(void)
+{
+    unsigned n, cnt = 0;
+
+    for (n = 0; n < n_comp_literal_lists; n++) {
+        CompoundLiteralList *l = &comp_literal_lists[n];
+
+        if ((l->type == TYPE_TEMP_ASSIGN || l->type == TYPE_CONST_DECL) &&
+            l->context.start < l->cast_token.start)
+            cnt++;
+    }
+
+    return cnt;
+}
+
+/*
+ * Print the tokens in t, starting at first. If first is 1, tokens[0] is
+ * the last token of the previous chunk, and the printer state is set up
+ * as if that token had just been printed, so that a chunk prints the same
+ * regardless of which thread prints it.
+ */
+static void print_chunk_tokens(TokenTable *t, unsigned first, unsigned tmp_base)
+{
+    unsigned lnum = 0, cpos = 0;
+    double t0 = stats_time();
+
+    if (first) {
+        const EmitToken *prev = &t->tokens[0];
+
+        prev_l = prev->line;
+        prev_p_end = prev->col + prev->extent;
+        lnum = prev->line;
+        cpos = prev->col + prev->extent;
+    } else {
+        prev_l = prev_p_end = -1;
+    }
+    unique_cntr = tmp_base;
+
+    print_token_range(t->tokens, first, t->n_tokens, &lnum, &cpos);
+    if (stats.enabled)
+        emit_stats.emit += get_time() - t0;
+}
+
+static void print_tokens(TokenTable *t)
+{
+    emit_structs = structs;
+    print_chunk_tokens(t, 0, 0);
+
+    // each file ends with a newline
+    write_output("\n", 1);
+}
+
+/*
+ * In chunked mode, each top-level declaration is visited, tokenized and
+ * printed on its own, after which its compound literal, struct/array and
+ * scope lists are dropped. Only the registries persist across chunks, so
+ * memory use scales with the largest declaration instead of with the whole
+ * translation unit, and output is written as we go. Declarations with
+ * overlapping extents (e.g. 'int a, b;') share a chunk, and tokens between
+ * two declarations are printed with the first one.
+ *
+ * With more than one thread, chunks are handed to a pool of emitter
+ * threads once visited, and printed into per-chunk buffers while the
+ * visitor (which is the only thread using libclang or modifying the
+ * registries) continues with the next declaration. Finished buffers are
+ * written out in order.
+ */
+#ifdef _WIN32
+typedef HANDLE Thread;
+typedef CRITICAL_SECTION Mutex;
+typedef CONDITION_VARIABLE Cond;
+#define mutex_init(m)       InitializeCriticalSection(m)
+#define mutex_destroy(m)    DeleteCriticalSection(m)
+#define mutex_lock(m)       EnterCriticalSection(m)
+#define mutex_unlock(m)     LeaveCriticalSection(m)
+#define cond_init(c)        InitializeConditionVariable(c)
+#define cond_destroy(c)
+#define cond_wait(c, m)     SleepConditionVariableCS(c, m, INFINITE)
+#define cond_broadcast(c)   WakeAllConditionVariable(c)
+#else
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Cond;
+#define mutex_init(m)       pthread_mutex_init(m, NULL)
+#define mutex_destroy(m)    pthread_mutex_destroy(m)
+#define mutex_lock(m)       pthread_mutex_lock(m)
+#define mutex_unlock(m)     pthread_mutex_unlock(m)
+#define cond_init(c)        pthread_cond_init(c, NULL)
+#define cond_destroy(c)     pthread_cond_destroy(c)
+#define cond_wait(c, m)     pthread_cond_wait(c, m)
+#define cond_broadcast(c)   pthread_cond_broadcast(c)
+#endif
+
+enum ChunkStatus {
+    CHUNK_QUEUED,
+    CHUNK_PRINTING,
+    CHUNK_PRINTED,
+};
+
+typedef struct Chunk Chunk;
+struct Chunk {
+    Chunk *next;
+    enum ChunkStatus status;
+    DeclLists lists;
+    TokenTable table;
+    unsigned first;              // see print_chunk_tokens()
+    unsigned tmp_base;
+    StructDeclaration *structs;  // see emit_structs
+    OutputBuffer output;
+};
+
+typedef struct {
+    Mutex lock;
+    Cond cond;                   // signalled whenever a chunk changes status
+    Chunk *head, *tail;          // in output order
+    unsigned n_chunks, max_chunks;
+    int finished;
+    Thread *threads;
+    unsigned n_threads;
+} EmitterPool;
+
+typedef struct {
+    CursorRecursion *root;
+    CXFile file;
+    unsigned start, end; // offsets of the pending chunk
+    int pending;
+    unsigned last;       // offset of the last token printed, if any
+    int have_last;
+    unsigned tmp_base;
+    EmitterPool *pool;   // NULL if printing on the visitor thread
+    TokenTable *lexed;   // NULL to tokenize chunks with libclang
+} ChunkState;
+
+// called with pool->lock held
+static void write_printed_chunks(EmitterPool *pool)
+{
+    while (pool->head && pool->head->status == CHUNK_PRINTED) {
+        Chunk *c = pool->head;
+
+        fwrite(c->output.data, 1, c->output.size, out);
+        pool->head = c->next;
+        if (!pool->head)
+            pool->tail = NULL;
+        pool->n_chunks--;
+        free(c->output.data);
+        free(c);
+    }
+}
+
+#ifdef _WIN32
+static unsigned __stdcall emitter_thread(void *arg)
+#else
+static void *emitter_thread(void *arg)
+#endif
+{
+    EmitterPool *pool = (EmitterPool *) arg;
+    Chunk *c;
+
+    mutex_lock(&pool->lock);
+    for (;;) {
+        for (c = pool->head; c && c->status != CHUNK_QUEUED; c = c->next) ;
+        if (!c) {
+            if (pool->finished)
+                break;
+            cond_wait(&pool->cond, &pool->lock);
+            continue;
+        }
+        c->status = CHUNK_PRINTING;
+        mutex_unlock(&pool->lock);
+
+        load_decl_lists(&c->lists);
+        emit_structs = c->structs;
+        out_buf = &c->output;
+        print_chunk_tokens(&c->table, c->first, c->tmp_base);
+        out_buf = NULL;
+        free_decl_lists();
+        free_token_table(&c->table);
+
+        mutex_lock(&pool->lock);
+        merge_emit_stats();
+        c->status = CHUNK_PRINTED;
+        write_printed_chunks(pool);
+        cond_broadcast(&pool->cond);
+    }
+    mutex_unlock(&pool->lock);
+
+    return 0;
+}
+
+static void start_emitter_pool(EmitterPool *pool, unsigned n_threads)
+{
+    unsigned n;
+
+    memset(pool, 0, sizeof(*pool));
+    mutex_init(&pool->lock);
+    cond_init(&pool->cond);
+    pool->max_chunks = n_threads * 4;
+    pool->threads = (Thread *) calloc(n_threads, sizeof(*pool->threads));
+    if (!pool->threads) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (n = 0; n < n_threads; n++) {
+#ifdef _WIN32
+        pool->threads[n] = (HANDLE) _beginthreadex(NULL, 0, emitter_thread,
+                                                   pool, 0, NULL);
+        if (!pool->threads[n]) {
+#else
+        if (pthread_create(&pool->threads[n], NULL, emitter_thread, pool)) {
+#endif
+            fprintf(stderr, "Unable to create emitter thread\n");
+            exit(1);
+        }
+        pool->n_threads++;
+    }
+}
+
+static void stop_emitter_pool(EmitterPool *pool)
+{
+    unsigned n;
+
+    mutex_lock(&pool->lock);
+    pool->finished = 1;
+    cond_broadcast(&pool->cond);
+    mutex_unlock(&pool->lock);
+
+    for (n = 0; n < pool->n_threads; n++) {
+#ifdef _WIN32
+        WaitForSingleObject(pool->threads[n], INFINITE);
+        CloseHandle(pool->threads[n]);
+#else
+        pthread_join(pool->threads[n], NULL);
+#endif
+    }
+    assert(!pool->head);
+    free(pool->threads);
+    cond_destroy(&pool->cond);
+    mutex_destroy(&pool->lock);
+}
+
+static void submit_chunk(EmitterPool *pool, Chunk *c)
+{
+    mutex_lock(&pool->lock);
+    while (pool->n_chunks >= pool->max_chunks)
+        cond_wait(&pool->cond, &pool->lock);
+    if (pool->tail)
+        pool->tail->next = c;
+    else
+        pool->head = c;
+    pool->tail = c;
+    pool->n_chunks++;
+    cond_broadcast(&pool->cond);
+    mutex_unlock(&pool->lock);
+}
+
+static void reset_decl_lists(void)
+{
+    unsigned n;
+
+    for (n = 0; n < n_struct_array_lists; n++)
+        free(struct_array_lists[n].entries);
+    n_struct_array_lists = 0;
+    n_comp_literal_lists = 0;
+    n_end_scopes = 0;
+}
+
+static void finish_chunk(ChunkState *s, CXSourceLocation end, unsigned end_off)
+{
+    CXToken *tokens = 0;
+    unsigned n_tokens = 0, n, first = 0, tmp_base;
+    CXSourceLocation begin;
+    TokenTable table;
+    double t0 = stats_time();
+
+    /* Start at the last token of the previous chunk: rewrites may step
+     * back by one token from the start of a declaration, like they can
+     * when the whole translation unit is printed at once. */
+    if (s->lexed) {
+        slice_token_table(&table, s->lexed,
+                          s->have_last ? s->last : s->start, end_off);
+    } else {
+        begin = clang_getLocationForOffset(TU, s->file,
+                                           s->have_last ? s->last : s->start);
+        clang_tokenize(TU, clang_getRange(begin, end), &tokens, &n_tokens);
+        build_token_table(&table, tokens, n_tokens);
+        clang_disposeTokens(TU, tokens, n_tokens);
+    }
+    if (s->have_last && table.n_tokens > 0)
+        first = 1;
+    stats_lap(PHASE_TOKENIZE, t0);
+
+    // the range may extend into the first token of the next chunk
+    for (n = first; n < table.n_tokens && table.tokens[n].offset < end_off; n++) ;
+    table.n_tokens = n;
+    if (DEBUG_LEVEL > 1)
+        dprintf("chunk %u-%u: %u tokens\n", s->start, end_off, n - first);
+    trace(TRACE_CHUNK, 0, s->start, end_off, n - first);
+    if (n > first) {
+        s->last = table.tokens[n - 1].offset;
+        s->have_last = 1;
+    }
+    stats.tokens += n - first;
+    count_decl_lists();
+
+    evaluate_union_float_values(table.tokens, table.n_tokens);
+    tmp_base = s->tmp_base;
+    s->tmp_base += count_tmp_vars();
+
+    if (s->pool) {
+        Chunk *c = (Chunk *) calloc(1, sizeof(*c));
+
+        if (!c) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        c->status = CHUNK_QUEUED;
+        save_decl_lists(&c->lists);
+        c->table = table;
+        c->first = first;
+        c->tmp_base = tmp_base;
+        c->structs = structs;
+        submit_chunk(s->pool, c);
+    } else {
+        emit_structs = structs;
+        print_chunk_tokens(&table, first, tmp_base);
+        fflush(out);
+        free_token_table(&table);
+        reset_decl_lists();
+    }
+}
+
+/*
+ * Targeted mode (-targeted): the TU is parsed as gnu89 with the warnings
+ * that flag C99-only constructs, and only top-level declarations that
+ * contain a flagged location are visited. Everything else only has its
+ * types registered, and is printed unchanged. A TU without flagged
+ * locations is copied to the output as-is.
+ *
+ * In C99 mode, clang only reports mixed declarations and code, hence the
+ * -std=gnu89 -pedantic; 'restrict' isn't a keyword in gnu89.
+ */
+static const char *targeted_args[] = {
+    "-std=gnu89", "-pedantic", "-Drestrict=__restrict",
+    "-Wdeclaration-after-statement", "-Wc99-extensions", "-Wc99-designator",
+};
+static const struct {
+    const char *option;
+    unsigned rewrites; // the warning is only relevant for these classes
+} targeted_warnings[] = {
+    { "-Wdeclaration-after-statement", REWRITE_MIXED_DECLS },
+    { "-Wc99-extensions", REWRITE_COMPOUND_LITERALS | REWRITE_LOOP_DECLS },
+    { "-Wc99-designator", REWRITE_DESIGNATED_INITS | REWRITE_UNION_INITS },
+};
+
+static int targeted = 0;
+static CXFile targeted_file = NULL;
+static unsigned *flagged_offsets = NULL;
+static unsigned n_flagged_offsets = 0;
+static unsigned n_allocated_flagged_offsets = 0;
+static unsigned n_top_level_decls = 0;
+static unsigned n_visited_decls = 0;
+
+static int compare_offsets(const void *a, const void *b)
+{
+    unsigned x = *(const unsigned *) a, y = *(const unsigned *) b;
+
+    return x < y ? -1 : x > y;
+}
+
+/*
+ * Collects flagged locations in file, and prints errors (the index
+ * doesn't display diagnostics in targeted mode, since -pedantic is noisy).
+ * Returns the number of errors.
+ */
+static unsigned collect_flagged_offsets(CXFile file)
+{
+    unsigned n, m, n_diags = clang_getNumDiagnostics(TU), n_errors = 0;
+
+    targeted_file = file;
+    for (n = 0; n < n_diags; n++) {
+        CXDiagnostic diag = clang_getDiagnostic(TU, n);
+        enum CXDiagnosticSeverity severity = clang_getDiagnosticSeverity(diag);
+        CXString option = clang_getDiagnosticOption(diag, NULL);
+        const char *str = clang_getCString(option);
+        CXFile diag_file;
+        unsigned line, col, off;
+
+        if (severity >= CXDiagnostic_Error) {
+            CXString msg = clang_formatDiagnostic(diag,
+                               clang_defaultDiagnosticDisplayOptions());
+            fprintf(stderr, "%s\n", clang_getCString(msg));
+            clang_disposeString(msg);
+            n_errors++;
+        }
+
+        clang_getSpellingLocation(clang_getDiagnosticLocation(diag),
+                                  &diag_file, &line, &col, &off);
+        for (m = 0; m < sizeof(targeted_warnings) / sizeof(targeted_warnings[0]); m++) {
+            if (diag_file != file || !(rewrites & targeted_warnings[m].rewrites) ||
+                strcmp(str, targeted_warnings[m].option))
+                continue;
+            if (n_flagged_offsets == n_allocated_flagged_offsets) {
+                unsigned num = n_allocated_flagged_offsets + 16;
+                void *mem = realloc(flagged_offsets,
+                                    sizeof(*flagged_offsets) * num);
+                if (!mem) {
+                    fprintf(stderr, "Failed to allocate diagnostic mem\n");
+                    exit(1);
+                }
+                flagged_offsets = (unsigned *) mem;
+                n_allocated_flagged_offsets = num;
+            }
+            flagged_offsets[n_flagged_offsets++] = off;
+            break;
         }
-        while (*clidx < n_comp_literal_lists &&
-               comp_literal_lists[*clidx].type == TYPE_UNKNOWN)
-            (*clidx)++;
-    } else {
-        print_token(tokens[*n], lnum, cpos);
+
+        clang_disposeString(option);
+        clang_disposeDiagnostic(diag);
     }
+    qsort(flagged_offsets, n_flagged_offsets, sizeof(*flagged_offsets),
+          compare_offsets);
 
-    while (*esidx < n_end_scopes && off >= end_scopes[*esidx].end - 1) {
-        int i;
-        for (i = 0; i < end_scopes[*esidx].n_scopes; i++)
-            print_literal_text("}", lnum, cpos);
-        (*cpos) -= end_scopes[*esidx].n_scopes;
-        (*esidx)++;
+    return n_errors;
+}
+
+static int range_is_flagged(CXFile file, unsigned start, unsigned end)
+{
+    unsigned lo = 0, hi = n_flagged_offsets;
+
+    if (file != targeted_file)
+        return 0;
+    // find the first flagged offset >= start
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (flagged_offsets[mid] < start)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
+
+    return lo < n_flagged_offsets && flagged_offsets[lo] <= end;
 }
 
-static void print_tokens(CXToken *tokens, unsigned n_tokens)
+static void free_flagged_offsets(void)
 {
-    unsigned cpos = 0, lnum = 0, n, saidx = 0, clidx = 0, esidx = 0, off;
+    free(flagged_offsets);
+    flagged_offsets = NULL;
+    n_flagged_offsets = n_allocated_flagged_offsets = 0;
+    targeted_file = NULL;
+    n_top_level_decls = n_visited_decls = 0;
+}
 
-    reorder_compound_literal_list(0);
+/*
+ * Entry point for top-level cursors: drives registry snapshots and, in
+ * targeted mode, decides whether the declaration is visited at all.
+ */
+static enum CXChildVisitResult visit_top_level(CXCursor cursor,
+                                               CXCursor parent,
+                                               CXClientData client_data)
+{
+    CXSourceRange range;
+    CXFile file, end_file;
+    unsigned line, col, start, end;
 
-    for (n = 0; n < n_tokens; n++) {
-        indent_for_token(tokens[n], &lnum, &cpos, &off);
-        print_token_wrapper(tokens, n_tokens, &n,
-                            &lnum, &cpos, &saidx, &clidx, &esidx, off);
+    // nothing to analyze (and no types to register) for this profile
+    if (!rewrites)
+        return CXChildVisit_Continue;
+    if (!n_registry_boundaries && !targeted)
+        return callback(cursor, parent, client_data);
+
+    range = clang_getCursorExtent(cursor);
+    clang_getSpellingLocation(clang_getRangeStart(range),
+                              &file, &line, &col, &start);
+    if (n_registry_boundaries)
+        registry_enter_top_level(file, start);
+    if (!targeted)
+        return callback(cursor, parent, client_data);
+
+    n_top_level_decls += file == targeted_file;
+    clang_getSpellingLocation(clang_getRangeEnd(range),
+                              &end_file, &line, &col, &end);
+    if (range_is_flagged(file, start, end)) {
+        n_visited_decls++;
+        return callback(cursor, parent, client_data);
     }
 
-    // each file ends with a newline
-    fprintf(out, "\n");
+    switch (cursor.kind) {
+    case CXCursor_TypedefDecl:
+    case CXCursor_StructDecl:
+    case CXCursor_UnionDecl:
+    case CXCursor_EnumDecl:
+        // nothing to rewrite, but later (flagged) code needs the types
+        return callback(cursor, parent, client_data);
+    case CXCursor_VarDecl: {
+        // e.g. 'struct X { int y; } var;'
+        TypedefDeclaration td;
+        memset(&td, 0, sizeof(td));
+        td.struct_decl_idx = (unsigned) -1;
+        td.enum_decl_idx = (unsigned) -1;
+        clang_visitChildren(cursor, find_anon_struct, &td);
+        break;
+    }
+    default:
+        break;
+    }
+
+    return CXChildVisit_Continue;
+}
+
+static enum CXChildVisitResult visit_chunk(CXCursor cursor, CXCursor parent,
+                                           CXClientData client_data)
+{
+    ChunkState *s = (ChunkState *) client_data;
+    CXSourceRange range = clang_getCursorExtent(cursor);
+    CXSourceLocation begin = clang_getRangeStart(range);
+    CXFile file;
+    unsigned line, col, start, end;
+
+    // declarations from other files are only registered, never printed
+    clang_getSpellingLocation(begin, &file, &line, &col, &start);
+    if (file == s->file) {
+        clang_getSpellingLocation(clang_getRangeEnd(range),
+                                  &file, &line, &col, &end);
+        if (s->pending && start >= s->end) {
+            finish_chunk(s, begin, start);
+            s->start = start;
+        }
+        if (!s->pending || end > s->end)
+            s->end = end;
+        s->pending = 1;
+    }
+
+    return visit_top_level(cursor, parent, s->root);
 }
 
 static void cleanup(void)
@@ -2643,6 +5981,8 @@ static void cleanup(void)
         }
     }
     free(comp_literal_lists);
+    comp_literal_lists = NULL;
+    n_comp_literal_lists = n_allocated_comp_literal_lists = 0;
 
     if (DEBUG_LEVEL > 1)
         dprintf("N array/struct variables: %d\n", n_struct_array_lists);
@@ -2670,9 +6010,10 @@ static void cleanup(void)
             }
         }
         free(struct_array_lists[n].entries);
-        free(struct_array_lists[n].name);
     }
     free(struct_array_lists);
+    struct_array_lists = NULL;
+    n_struct_array_lists = n_allocated_struct_array_lists = 0;
 
     if (DEBUG_LEVEL > 1) {
         dprintf("N extra scope ends: %d\n", n_end_scopes);
@@ -2682,11 +6023,12 @@ static void cleanup(void)
         }
     }
     free(end_scopes);
+    end_scopes = NULL;
+    n_end_scopes = n_allocated_end_scopes = 0;
 
-    if (DEBUG_LEVEL > 1)
+    if (DEBUG_LEVEL > 1) {
         dprintf("N typedef entries: %d\n", n_typedefs);
-    for (n = 0; n < n_typedefs; n++) {
-        if (DEBUG_LEVEL > 1) {
+        for (n = 0; n < n_typedefs; n++) {
             if (typedefs[n].struct_decl_idx != (unsigned) -1) {
                 if (structs[typedefs[n].struct_decl_idx].name[0]) {
                     dprintf("[%d]: %s (struct %s = %d)\n",
@@ -2714,25 +6056,15 @@ static void cleanup(void)
                         n, typedefs[n].name, typedefs[n].proxy);
             }
         }
-        if (typedefs[n].proxy)
-            free(typedefs[n].proxy);
-        free(typedefs[n].name);
-    }
-    free(typedefs);
 
-    // free memory
-    if (DEBUG_LEVEL > 1)
         dprintf("N struct entries: %d\n", n_structs);
-    for (n = 0; n < n_structs; n++) {
-        if (DEBUG_LEVEL > 1) {
+        for (n = 0; n < n_structs; n++) {
             if (structs[n].name[0]) {
                 dprintf("[%d]: %s (%p)\n", n, structs[n].name, &structs[n]);
             } else {
                 dprintf("[%d]: <anonymous> (%p)\n", n, &structs[n]);
             }
-        }
-        for (m = 0; m < structs[n].n_entries; m++) {
-            if (DEBUG_LEVEL > 1) {
+            for (m = 0; m < structs[n].n_entries; m++) {
                 dprintf(" [%d]: %s (%s/%d/%d/%u)\n",
                         m, structs[n].entries[m].name,
                         structs[n].entries[m].type,
@@ -2740,79 +6072,700 @@ static void cleanup(void)
                         structs[n].entries[m].array_depth,
                         structs[n].entries[m].struct_decl_idx);
             }
-            free(structs[n].entries[m].type);
-            free(structs[n].entries[m].name);
         }
-        free(structs[n].entries);
-        free(structs[n].name);
-    }
-    free(structs);
 
-    if (DEBUG_LEVEL > 1)
         dprintf("N enum entries: %d\n", n_enums);
-    for (n = 0; n < n_enums; n++) {
-        if (DEBUG_LEVEL > 1) {
+        for (n = 0; n < n_enums; n++) {
             if (enums[n].name[0]) {
                 dprintf("[%d]: %s (%p)\n", n, enums[n].name, &enums[n]);
             } else {
                 dprintf("[%d]: <anonymous> (%p)\n", n, &enums[n]);
             }
-        }
-        for (m = 0; m < enums[n].n_entries; m++) {
-            if (DEBUG_LEVEL > 1) {
-                dprintf(" [%d]: %s = %d\n", m,
+            for (m = 0; m < enums[n].n_entries; m++) {
+                dprintf(" [%d]: %s = %"PRId64"\n", m,
                         enums[n].entries[m].name,
                         enums[n].entries[m].value);
             }
-            free(enums[n].entries[m].name);
         }
-        free(enums[n].entries);
-        free(enums[n].name);
     }
-    free(enums);
+
+    // all registry memory lives in the arena (or a snapshot mapping)
+    arena_release();
+    release_registry_snapshots();
+    typedefs = NULL;
+    n_typedefs = n_allocated_typedefs = 0;
+    structs = NULL;
+    n_structs = n_allocated_structs = 0;
+    enums = NULL;
+    n_enums = n_allocated_enums = 0;
+
+    free(constant_cache);
+    constant_cache = NULL;
+    n_constant_cache = n_allocated_constant_cache = 0;
+
+    for (n = 0; n < n_line_markers; n++)
+        free(line_markers[n].name);
+    free(line_markers);
+    line_markers = NULL;
+    n_line_markers = n_allocated_line_markers = 0;
+
+    free_cursor_stack();
+    free_flagged_offsets();
+    targeted = 0;
+    rewrites = REWRITE_ALL;
+}
+
+enum Lexing {
+    LEX_BUILTIN = 0, // see lex_tokens()
+    LEX_LIBCLANG,
+    LEX_CHECK,       // built-in, but verified against libclang
+};
+
+typedef struct ConvertOptions {
+    int ms_compat;
+    const char *target;
+    int chunked;
+    unsigned n_threads;
+    const char *cache_dir; // serialized AST cache, NULL disables it
+    int preamble;          // keep the TU around and reparse it
+    int targeted;          // only visit declarations flagged by diagnostics
+    enum Lexing lexing;
+    int timing;            // print per-TU parse timings to stderr
+    const char *stats;     // see print_stats(), NULL if disabled
+    int update;            // only replace the output if it changed
+    int edits;             // write an edit list, see EditList
+    int compact;           // replace runs of empty lines by #line
+    unsigned rewrites;     // REWRITE_*, from -profile=
+} ConvertOptions;
+
+static CXIndex conv_index = NULL;
+static char *preamble_file = NULL;
+static uint64_t preamble_key = 0;
+
+static void dispose_translation_unit(const ConvertOptions *opts)
+{
+    // with -preamble, the TU stays alive so that the next conversion of
+    // the same file can be a cheap reparse
+    if (opts->preamble)
+        return;
+    clang_disposeTranslationUnit(TU);
+    TU = NULL;
+}
+
+static void release_parser(void)
+{
+    if (TU)
+        clang_disposeTranslationUnit(TU);
+    TU = NULL;
+    free(preamble_file);
+    preamble_file = NULL;
+    if (conv_index)
+        clang_disposeIndex(conv_index);
+    conv_index = NULL;
+}
+
+static CXTranslationUnit parse_file(const char *file, const char **argv,
+                                    int argc, struct CXUnsavedFile *unsaved,
+                                    unsigned n_unsaved, unsigned flags)
+{
+#if CINDEX_VERSION_MINOR >= 30
+    CXTranslationUnit tu = NULL;
+    enum CXErrorCode err;
+
+    err = clang_parseTranslationUnit2(conv_index, file, argv, argc,
+                                      unsaved, n_unsaved, flags, &tu);
+    if (err != CXError_Success) {
+        dprintf("clang_parseTranslationUnit2(%s): error %d\n", file, err);
+        return NULL;
+    }
+    return tu;
+#else
+    return clang_parseTranslationUnit(conv_index, file, argv, argc,
+                                      unsaved, n_unsaved, flags);
+#endif
+}
+
+static void save_cache_dep(CXFile file, CXSourceLocation *stack,
+                           unsigned depth, CXClientData data)
+{
+    CXString name;
+
+    // the main file is covered by the cache key
+    if (!depth)
+        return;
+    name = clang_getFileName(file);
+    fprintf((FILE *) data, "%lld %s\n", (long long) clang_getFileTime(file),
+            clang_getCString(name));
+    clang_disposeString(name);
+}
+
+/*
+ * Lists the files the TU includes, with their mtimes, in deps_file. A
+ * cached AST is only used while they are unchanged (see cache_deps_valid()),
+ * since the cache key only covers the main file.
+ */
+static int save_cache_deps(const char *deps_file)
+{
+    char tmp[4096 + 32];
+    FILE *f;
+
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", deps_file, (int) getpid());
+    if (!(f = fopen(tmp, "w")))
+        return 1;
+    clang_getInclusions(TU, save_cache_dep, f);
+    if (fclose(f) || replace_file(tmp, deps_file)) {
+        remove(tmp);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int cache_deps_valid(const char *deps_file)
+{
+    FILE *f = fopen(deps_file, "r");
+    char line[4096 + 32];
+    int valid = 1;
+
+    if (!f)
+        return 0;
+    while (valid && fgets(line, sizeof(line), f)) {
+        struct stat st;
+        char *name;
+        long long mtime = strtoll(line, &name, 10);
+
+        name[strcspn(name, "\n")] = 0;
+        if (*name != ' ' || stat(name + 1, &st) ||
+            (long long) st.st_mtime != mtime)
+            valid = 0;
+    }
+    fclose(f);
+
+    return valid;
+}
+
+/* Whether the TU has fatal diagnostics (e.g. a missing header) */
+static int has_fatal_diagnostics(void)
+{
+    unsigned n, n_diags = clang_getNumDiagnostics(TU), n_fatal = 0;
+
+    for (n = 0; n < n_diags; n++) {
+        CXDiagnostic diag = clang_getDiagnostic(TU, n);
+
+        if (clang_getDiagnosticSeverity(diag) == CXDiagnostic_Fatal)
+            n_fatal++;
+        clang_disposeDiagnostic(diag);
+    }
+
+    return n_fatal > 0;
+}
+
+/*
+ * Produce TU for infile, whose contents (data) and cache key are only
+ * needed with a cache or -preamble. When data is given, it is what gets
+ * parsed, as an unsaved file under the name infile. TUs with fatal errors
+ * (e.g. a missing header) are converted, but not cached.
+ */
+static int load_translation_unit(const char *infile,
+                                 const char *data, size_t len, uint64_t key,
+                                 const char **argv, int argc,
+                                 const ConvertOptions *opts)
+{
+    unsigned flags = CXTranslationUnit_DetailedPreprocessingRecord;
+    struct CXUnsavedFile unsaved;
+    unsigned n_unsaved = 0;
+    char ast_file[4096], deps_file[4096];
+    const char *how = "parse";
+    double t0 = get_time();
+
+    ast_file[0] = 0;
+    if (data) {
+        unsaved.Filename = infile;
+        unsaved.Contents = data;
+        unsaved.Length = len;
+        n_unsaved = 1;
+    }
+
+    if (!conv_index)
+        conv_index = clang_createIndex(1, !opts->targeted);
+
+    if (opts->preamble) {
+        flags |= CXTranslationUnit_PrecompiledPreamble;
+#if CINDEX_VERSION_MINOR >= 30
+        flags |= CXTranslationUnit_CreatePreambleOnFirstParse;
+#endif
+    }
+
+    if (opts->cache_dir) {
+#ifdef _WIN32
+        _mkdir(opts->cache_dir);
+#else
+        mkdir(opts->cache_dir, 0777);
+#endif
+        snprintf(ast_file, sizeof(ast_file), "%s/%016"PRIx64".ast",
+                 opts->cache_dir, key);
+        snprintf(deps_file, sizeof(deps_file), "%s/%016"PRIx64".deps",
+                 opts->cache_dir, key);
+        flags |= CXTranslationUnit_ForSerialization;
+    }
+
+    if (TU && preamble_file && preamble_key == key &&
+        !strcmp(preamble_file, infile)) {
+        if (!clang_reparseTranslationUnit(TU, n_unsaved, &unsaved, 0))
+            how = "reparse";
+        else {
+            clang_disposeTranslationUnit(TU);
+            TU = NULL;
+        }
+    } else if (TU) {
+        clang_disposeTranslationUnit(TU);
+        TU = NULL;
+    }
+
+    if (!TU && ast_file[0] && file_exists(ast_file) &&
+        cache_deps_valid(deps_file)) {
+        TU = clang_createTranslationUnit(conv_index, ast_file);
+        if (TU)
+            how = "cache hit";
+        else
+            dprintf("Unable to load %s, reparsing\n", ast_file);
+    }
+
+    if (!TU) {
+        TU = parse_file(infile, argv, argc, &unsaved, n_unsaved, flags);
+        if (TU && ast_file[0] && !has_fatal_diagnostics()) {
+            char tmp[4096 + 32];
+            how = "cache miss";
+            snprintf(tmp, sizeof(tmp), "%s.%d.tmp", ast_file, (int) getpid());
+            if (save_cache_deps(deps_file) ||
+                clang_saveTranslationUnit(TU, tmp, CXSaveTranslationUnit_None) ||
+                replace_file(tmp, ast_file)) {
+                dprintf("Unable to save %s\n", ast_file);
+                remove(tmp);
+            }
+        }
+    }
+
+    if (!TU) {
+        fprintf(stderr, "Unable to parse input file %s\n", infile);
+        return 1;
+    }
+
+    if (opts->preamble) {
+        free(preamble_file);
+        preamble_file = strdup(infile);
+        preamble_key = key;
+    }
+
+    dprintf("%s: %s in %.3f ms\n", infile, how, (get_time() - t0) * 1000.0);
+    if (opts->timing)
+        fprintf(stderr, "%s: %s in %.3f ms\n", infile, how,
+                (get_time() - t0) * 1000.0);
+
+    return 0;
+}
+
+/*
+ * Whether libclang lexes "::" as a single token in C, which depends on its
+ * version (newer ones accept C23 attributes in all modes). Asks libclang
+ * about the first "::" in t, lexed without LEX_OPT_COLONCOLON.
+ */
+static int probe_coloncolon(CXFile file, const TokenTable *t)
+{
+    CXToken *tokens = NULL;
+    unsigned n, n_tokens = 0;
+
+    for (n = 0; n + 1 < t->n_tokens; n++) {
+        if (!strcmp(t->tokens[n].spelling, ":") &&
+            t->tokens[n + 1].spelling[0] == ':' && // ":" or ":>"
+            t->tokens[n + 1].offset == t->tokens[n].offset + 1)
+            break;
+    }
+    if (n + 1 >= t->n_tokens)
+        return 0;
+    clang_tokenize(TU, clang_getRange(
+                       clang_getLocationForOffset(TU, file, t->tokens[n].offset),
+                       clang_getLocationForOffset(TU, file, t->tokens[n].offset + 2)),
+                   &tokens, &n_tokens);
+    clang_disposeTokens(TU, tokens, n_tokens);
+
+    return n_tokens == 1;
 }
 
-int convert(const char *infile, const char *outfile, int ms_compat, const char *target)
+int convert(const char *infile, const char *outfile,
+            const ConvertOptions *opts)
 {
-    CXIndex index;
     unsigned n_tokens;
     CXToken *tokens;
     CXSourceRange range;
     CXCursor cursor;
-    CursorRecursion rec;
-    const char *ms_argv[] = { "-fms-extensions", "-target", target, "-Wno-microsoft-anon-tag", NULL };
-    const char **argv = NULL;
+    CursorRecursion *rec;
+    char tmp_file[4096 + 32];
+    const char *out_file = outfile;
+    TokenTable lexed = { NULL, 0, NULL };
+    char *data = NULL;
+    size_t len = 0;
+    uint64_t key = 0;
+    const char *ms_argv[] = { "-fms-extensions", "-target", opts->target, "-Wno-microsoft-anon-tag" };
+    const char *argv[16];
     int argc = 0;
-    if (ms_compat) {
-        argv = ms_argv;
-        argc = (sizeof(ms_argv) / sizeof(ms_argv[0])) - 1;
+    unsigned n;
+    double t0, t_excl;
+    static unsigned n_inputs = 0;
+
+    trace(TRACE_CONVERT, 0, n_inputs++, 0, 0);
+    memset(&stats, 0, sizeof(stats));
+    stats.enabled = opts->stats != NULL;
+    t0 = stats_time();
+    if (opts->ms_compat) {
+        for (n = 0; n < sizeof(ms_argv) / sizeof(ms_argv[0]); n++)
+            argv[argc++] = ms_argv[n];
+    }
+    if (opts->targeted) {
+        for (n = 0; n < sizeof(targeted_args) / sizeof(targeted_args[0]); n++)
+            argv[argc++] = targeted_args[n];
+    }
+
+    if (opts->cache_dir || opts->preamble || opts->targeted || opts->edits ||
+        opts->compact) {
+        data = read_file(infile, &len);
+        if (!data) {
+            fprintf(stderr, "Unable to open input file %s\n", infile);
+            return 1;
+        }
+        key = cache_key(infile, data, len, argv, argc);
+    }
+
+    if (load_translation_unit(infile, data, len, key, argv, argc, opts)) {
+        free(data);
+        return 1;
+    }
+    stats_lap(PHASE_PARSE, t0);
+    if (stats.enabled)
+        stats.bytes_in = data ? len : file_size(infile);
+
+    if (opts->cache_dir) {
+        double t0 = get_time();
+        unsigned frozen = init_registry_snapshots(opts->cache_dir,
+                                                  clang_getFile(TU, infile),
+                                                  data, len,
+                                                  cache_key(NULL, "", 0, argv, argc));
+        if (opts->timing)
+            fprintf(stderr, "%s: registry snapshot covers %u of %u bytes "
+                    "(%.3f ms)\n", infile, frozen, (unsigned) len,
+                    (get_time() - t0) * 1000.0);
+        stats_lap(PHASE_REGISTRY, t0);
+    }
+
+    if (opts->update) {
+        snprintf(tmp_file, sizeof(tmp_file), "%s.%d.tmp", outfile,
+                 (int) getpid());
+        out_file = tmp_file;
     }
 
-    out    = fopen(outfile, "w");
+    targeted = opts->targeted;
+    rewrites = opts->rewrites;
+    compact = opts->compact;
+    if (targeted && !collect_flagged_offsets(clang_getFile(TU, infile)) &&
+        !n_flagged_offsets) {
+        // nothing to rewrite
+        int res = 0;
+        FILE *f = fopen(out_file, "wb");
+        if (f && opts->edits) {
+            // the output is the input, so there are no edits
+            start_edits(&edit_list, f, infile, data, len);
+            edits = &edit_list;
+            write_output(data, len);
+            finish_edits();
+            edits = NULL;
+            data = NULL;
+            res = ferror(f);
+        } else if (!f || fwrite(data, 1, len, f) != len) {
+            res = 1;
+        }
+        if (res)
+            fprintf(stderr, "Unable to write output file %s\n", outfile);
+        if (f)
+            fclose(f);
+        if (opts->update && res)
+            remove(tmp_file);
+        else if (opts->update)
+            res = update_file(tmp_file, outfile);
+        if (opts->timing)
+            fprintf(stderr, "%s: no rewrite needed\n", infile);
+        if (stats.enabled && !res) {
+            stats.bytes_out = len;
+            print_stats(opts->stats, infile);
+        }
+        free(data);
+        dispose_translation_unit(opts);
+        cleanup();
+        return res;
+    }
+    if (compact)
+        find_line_markers(data, len);
+    if (!opts->edits) {
+        free(data);
+        data = NULL;
+    }
+
+    out    = fopen(out_file, "w");
     if (!out) {
         fprintf(stderr, "Unable to open output file %s\n", outfile);
+        free(data);
+        dispose_translation_unit(opts);
         return 1;
     }
-    index  = clang_createIndex(1, 1);
-    TU     = clang_createTranslationUnitFromSourceFile(index, infile, argc,
-                                                       argv, 0, NULL);
     cursor = clang_getTranslationUnitCursor(TU);
     range  = clang_getCursorExtent(cursor);
-    clang_tokenize(TU, range, &tokens, &n_tokens);
 
-    memset(&rec, 0, sizeof(rec));
-    rec.tokens = tokens;
-    rec.n_tokens = n_tokens;
-    rec.kind = CXCursor_TranslationUnit;
-    clang_visitChildren(cursor, callback, &rec);
-    print_tokens(tokens, n_tokens);
-    clang_disposeTokens(TU, tokens, n_tokens);
+    if (opts->lexing != LEX_LIBCLANG) {
+        double t0 = get_time();
+        unsigned lex_opts = (opts->targeted ? 0 : LEX_OPT_C99) |
+                            (opts->ms_compat ? LEX_OPT_MS_EXT : 0);
+        if (lex_file(&lexed, infile, lex_opts)) {
+            fprintf(stderr, "Unable to open input file %s\n", infile);
+            fclose(out);
+            free(data);
+            if (opts->update)
+                remove(tmp_file);
+            dispose_translation_unit(opts);
+            cleanup();
+            return 1;
+        }
+        if (probe_coloncolon(clang_getFile(TU, infile), &lexed)) {
+            free_token_table(&lexed);
+            lex_file(&lexed, infile, lex_opts | LEX_OPT_COLONCOLON);
+        }
+        dprintf("Lexed %u tokens in %.3f ms\n", lexed.n_tokens,
+                (get_time() - t0) * 1000.0);
+        if (opts->lexing == LEX_CHECK) {
+            TokenTable table;
+            int res;
+
+            clang_tokenize(TU, range, &tokens, &n_tokens);
+            build_token_table(&table, tokens, n_tokens);
+            clang_disposeTokens(TU, tokens, n_tokens);
+            res = compare_token_tables(&lexed, &table);
+            free_token_table(&table);
+            if (res) {
+                fprintf(stderr, "Built-in lexer mismatch in %s\n", infile);
+                free_token_table(&lexed);
+                fclose(out);
+                free(data);
+                if (opts->update)
+                    remove(tmp_file);
+                dispose_translation_unit(opts);
+                cleanup();
+                return 1;
+            }
+        }
+        stats_lap(PHASE_TOKENIZE, t0);
+    }
 
-    clang_disposeTranslationUnit(TU);
-    clang_disposeIndex(index);
+    if (opts->edits) {
+        start_edits(&edit_list, out, infile, data, len);
+        edits = &edit_list;
+    }
+    if (opts->chunked) {
+        ChunkState s;
+        EmitterPool pool;
+
+        memset(&s, 0, sizeof(s));
+        s.root = push_cursor_recursion(CXCursor_TranslationUnit, NULL);
+        s.file = clang_getFile(TU, infile);
+        if (opts->lexing != LEX_LIBCLANG)
+            s.lexed = &lexed;
+        if (opts->n_threads > 1 && !edits) {
+            start_emitter_pool(&pool, opts->n_threads);
+            s.pool = &pool;
+        }
+        // chunks are tokenized, and without threads printed, while visiting
+        t0 = stats_time();
+        t_excl = stats.time[PHASE_TOKENIZE] + emit_stats.emit;
+        clang_visitChildren(cursor, visit_chunk, &s);
+        finish_chunk(&s, clang_getRangeEnd(range), (unsigned) -1);
+        stats_lap(PHASE_VISIT, t0);
+        stats.time[PHASE_VISIT] -= stats.time[PHASE_TOKENIZE] +
+                                   emit_stats.emit - t_excl;
+        if (s.pool)
+            stop_emitter_pool(&pool);
+        pop_cursor_recursion();
+        write_output("\n", 1);
+    } else {
+        TokenTable table;
+
+        t0 = stats_time();
+        clang_tokenize(TU, range, &tokens, &n_tokens);
+        t0 = stats_lap(PHASE_TOKENIZE, t0);
+
+        rec = push_cursor_recursion(CXCursor_TranslationUnit, NULL);
+        rec->tokens = tokens;
+        rec->n_tokens = n_tokens;
+        clang_visitChildren(cursor, visit_top_level, rec);
+        pop_cursor_recursion();
+        t0 = stats_lap(PHASE_VISIT, t0);
+
+        if (opts->lexing != LEX_LIBCLANG) {
+            table = lexed;
+            memset(&lexed, 0, sizeof(lexed));
+        } else {
+            build_token_table(&table, tokens, n_tokens);
+        }
+        clang_disposeTokens(TU, tokens, n_tokens);
+        t0 = stats_lap(PHASE_TOKENIZE, t0);
+        stats.tokens = table.n_tokens;
+        count_decl_lists();
+        evaluate_union_float_values(table.tokens, table.n_tokens);
+        stats_lap(PHASE_VISIT, t0);
+        print_tokens(&table);
+        free_token_table(&table);
+    }
+    if (edits) {
+        finish_edits();
+        edits = NULL;
+    }
+    merge_emit_stats();
+
+    if (targeted) {
+        dprintf("Visited %u of %u top-level declarations\n",
+                n_visited_decls, n_top_level_decls);
+        if (opts->timing)
+            fprintf(stderr, "%s: visited %u of %u top-level declarations "
+                    "(%u flagged locations)\n", infile, n_visited_decls,
+                    n_top_level_decls, n_flagged_offsets);
+    }
+    free_token_table(&lexed);
+    dispose_translation_unit(opts);
 
     cleanup();
+    if (stats.enabled) {
+        fflush(out);
+        stats.bytes_out = (size_t) ftell(out);
+    }
     fclose(out);
+    if (opts->update && update_file(tmp_file, outfile))
+        return 1;
+    if (stats.enabled)
+        print_stats(opts->stats, infile);
+
+    return 0;
+}
+
+// C99CONV_NO_MAIN builds convert() into another program (e.g. a fuzzer)
+#if !defined(C99CONV_NO_MAIN)
+/*
+ * Prints a trace written by trace_dump() as text. With the source file
+ * that was converted, offsets are shown as line:column along with the
+ * source text there.
+ */
+static int decode_trace(const char *name, const char *source)
+{
+    static const char *event_names[N_TRACE_EVENTS] = {
+        NULL, "convert", "cursor", "token", "compound-literal", "init-list",
+        "init-entry", "filler", "assignment", "end-scope", "chunk",
+    };
+    static const char *from_names[] = {
+        "var-decl", "compound-literal", "enclosing-list",
+    };
+    static const char *list_types[] = { "irrelevant", "struct", "array" };
+    char *data, *src = NULL;
+    size_t len, src_len = 0;
+    const TraceHeader *h;
+    const TraceRecord *r;
+    uint32_t n;
+
+    data = read_file(name, &len);
+    h = (const TraceHeader *) data;
+    if (!data || len < sizeof(*h) || memcmp(h->magic, "C99TRACE", 8) ||
+        h->version != 1 || h->record_size != sizeof(TraceRecord) ||
+        len < sizeof(*h) + (size_t) h->n_records * sizeof(TraceRecord)) {
+        fprintf(stderr, "%s is not a c99conv trace\n", name);
+        free(data);
+        return 1;
+    }
+    if (source && !(src = read_file(source, &src_len))) {
+        fprintf(stderr, "Unable to open input file %s\n", source);
+        free(data);
+        return 1;
+    }
+
+    r = (const TraceRecord *) (data + sizeof(*h));
+    for (n = 0; n < h->n_records; n++, r++) {
+        uint32_t offset = r->a;
+        CXString kind;
+
+        if (!r->event || r->event >= N_TRACE_EVENTS) {
+            printf("%"PRIu64" bad event %u\n", h->head - h->n_records + n,
+                   r->event);
+            continue;
+        }
+        printf("%"PRIu64" %s", h->head - h->n_records + n,
+               event_names[r->event]);
+        switch (r->event) {
+        case TRACE_CONVERT:
+            printf(" input=%u", r->a);
+            break;
+        case TRACE_CURSOR:
+            kind = clang_getCursorKindSpelling((enum CXCursorKind) r->kind);
+            printf(" %s", clang_getCString(kind));
+            clang_disposeString(kind);
+            kind = clang_getCursorKindSpelling((enum CXCursorKind) r->c);
+            printf(" in %s, %u tokens", clang_getCString(kind), r->b);
+            clang_disposeString(kind);
+            break;
+        case TRACE_TOKEN:
+            printf(" %u:%u", r->b, r->c);
+            break;
+        case TRACE_COMP_LITERAL:
+            printf(" list=%u", r->a);
+            offset = r->b;
+            break;
+        case TRACE_INIT_LIST:
+            printf(" list=%u from=%s struct=%d", r->a,
+                   r->kind < 3 ? from_names[r->kind] : "?", (int) r->c);
+            offset = r->b;
+            break;
+        case TRACE_INIT_ENTRY:
+            printf(" list=%u type=%s index=%u", r->a,
+                   r->kind < 3 ? list_types[r->kind] : "?", r->c);
+            offset = r->b;
+            break;
+        case TRACE_FILLER:
+            printf(" list=%u index=%u", r->a, r->c);
+            offset = r->b;
+            break;
+        case TRACE_ASSIGNMENT:
+            printf(" list=%u", r->a);
+            break;
+        case TRACE_END_SCOPE:
+            printf(" scopes=%u", r->b);
+            break;
+        case TRACE_CHUNK:
+            printf(" end=%u tokens=%u", r->b, r->c);
+            break;
+        }
+        if (r->event != TRACE_CONVERT && r->event != TRACE_ASSIGNMENT) {
+            printf(" @%u", offset);
+            if (src && offset < src_len) {
+                size_t start = offset, end = offset, line = 1, m;
+
+                while (start > 0 && src[start - 1] != '\n')
+                    start--;
+                for (m = 0; m < start; m++)
+                    line += src[m] == '\n';
+                while (end < src_len && end - offset < 40 &&
+                       src[end] != '\n' && src[end] != '\r')
+                    end++;
+                printf(" %u:%u | %.*s", (unsigned) line,
+                       (unsigned) (offset - start + 1), (int) (end - offset),
+                       src + offset);
+            }
+        }
+        printf("\n");
+    }
+    free(src);
+    free(data);
 
     return 0;
 }
@@ -2831,27 +6784,94 @@ int WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int n
         DEBUG_LEVEL = (int)strtoll(envvar, NULL, 10);
         envvar = NULL;
     }
+    if (argc >= 3 && argc <= 4 && !strcmp(argv[1], "-decodetrace"))
+        return decode_trace(argv[2], argc == 4 ? argv[3] : NULL);
+    trace_init();
+
+    ConvertOptions opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.n_threads = 1;
+    opts.rewrites = REWRITE_ALL;
+    opts.cache_dir = getenv("C99_TO_C89_CONV_CACHE_DIR");
+    if (opts.cache_dir && !opts.cache_dir[0])
+        opts.cache_dir = NULL;
+    opts.stats = getenv("C99_TO_C89_CONV_STATS");
+    if (opts.stats && !opts.stats[0])
+        opts.stats = NULL;
 
     dprintf("%s ", argv[0]);
     int arg = 1;
-    int ms_compat = 0;
     int target_64 = 0;
+    int ret = 0;
     while (arg < argc) {
         dprintf("%s ", argv[arg]);
         if (!strcmp(argv[arg], "-ms"))
-            ms_compat = 1;
+            opts.ms_compat = 1;
         else if (!strcmp(argv[arg], "-64"))
             target_64 = 1;
         else if (!strcmp(argv[arg], "-32"))
             target_64 = 0;
-        else {
+        else if (!strcmp(argv[arg], "-chunked"))
+            opts.chunked = 1;
+        else if (!strncmp(argv[arg], "-j", 2) && argv[arg][2]) {
+            // threaded printing implies chunked mode
+            opts.n_threads = (unsigned) strtoll(&argv[arg][2], NULL, 10);
+            if (opts.n_threads < 1)
+                opts.n_threads = 1;
+            opts.chunked = 1;
+        } else if (!strcmp(argv[arg], "-cache") && arg + 1 < argc) {
+            opts.cache_dir = argv[++arg];
+        } else if (!strcmp(argv[arg], "-preamble"))
+            opts.preamble = 1;
+        else if (!strcmp(argv[arg], "-time"))
+            opts.timing = 1;
+        else if (!strncmp(argv[arg], "-stats=", 7))
+            opts.stats = &argv[arg][7];
+        else if (!strncmp(argv[arg], "--stats=", 8))
+            opts.stats = &argv[arg][8];
+        else if (!strcmp(argv[arg], "-targeted"))
+            opts.targeted = 1;
+        else if (!strcmp(argv[arg], "-update"))
+            opts.update = 1;
+        else if (!strcmp(argv[arg], "-edits"))
+            opts.edits = 1;
+        else if (!strcmp(argv[arg], "-compact"))
+            opts.compact = 1;
+        else if (!strcmp(argv[arg], "-clanglex"))
+            opts.lexing = LEX_LIBCLANG;
+        else if (!strcmp(argv[arg], "-lexcheck"))
+            opts.lexing = LEX_CHECK;
+        else if (!strncmp(argv[arg], "-profile=", 9)) {
+            unsigned n;
+            for (n = 0; n < sizeof(profiles) / sizeof(profiles[0]); n++) {
+                if (!strcmp(&argv[arg][9], profiles[n].name))
+                    break;
+            }
+            if (n == sizeof(profiles) / sizeof(profiles[0])) {
+                fprintf(stderr, "Unknown profile %s (vs2008, vs2013 or vs2015)\n",
+                        &argv[arg][9]);
+                return 1;
+            }
+            opts.rewrites = profiles[n].rewrites;
+        } else {
             break;
         }
         arg++;
     }
-    if (argc < arg + 2) {
-        fprintf(stderr, "%s [-ms] [-64|-32] <in> <out>\n", argv[0]);
+    if (argc < arg + 2 || (argc - arg) % 2) {
+        fprintf(stderr, "%s [-ms] [-64|-32] [-chunked] [-j<threads>] [-cache <dir>] [-preamble] [-targeted] [-update] [-edits] [-compact] [-clanglex|-lexcheck] [-profile=vs2008|vs2013|vs2015] [-time] [-stats=json|<file>] <in> <out> [<in> <out> ...]\n"
+                "%s -decodetrace <trace> [<in>]\n", argv[0], argv[0]);
         return 1;
     }
-    return convert(argv[arg], argv[arg + 1], ms_compat, target_64 ? "x86_64-pc-win32" : "i386-pc-win32");
+    opts.target = target_64 ? "x86_64-pc-win32" : "i386-pc-win32";
+
+    // batch mode: all pairs share one index (and, with -preamble, the TU)
+    for (; arg + 1 < argc; arg += 2) {
+        if (convert(argv[arg], argv[arg + 1], &opts))
+            ret = 1;
+    }
+    release_parser();
+
+    return ret;
 }
+#endif
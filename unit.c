@@ -7,6 +7,7 @@ struct AVRational2 { int num; int den; char **test[3]; };
 typedef struct AVRational2 AVRational2;
 typedef struct AVRational4 AVRational4;
 typedef struct { int num, den; struct AVRational test; } AVRational3;
+typedef int x;
 
 static AVRational  gap_test() {
     AVRational gap = { .den = 4 };
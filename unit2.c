@@ -77,6 +77,7 @@ int mixed_array[] = {
     2,
     [PIX_FMT_RGBA] = 3,
     4,
+    [PIX_FMT_YUV420P && 100 / PIX_FMT_YUV420P ? 100 / PIX_FMT_YUV420P : 9] = 5,
 };
 
 static const struct {
@@ -0,0 +1,35 @@
+/*
+ * Unit test for the built-in lexer: CRLF line endings and line splices,
+ * also inside tokens, strings and comments. \
+   This line continues the comment.
+ */
+
+typedef struct Spliced { int num, den; } Spliced;
+
+#define SPLICED_MACRO(x) \
+    ((x) + 1)
+
+static const char *str = "spli\
+ced string";
+static const char chr = '\
+a';
+
+// a line comment \
+   that continues here
+
+static int spli\
+ced_function(Spliced s)
+{
+    return s.num *\
+= SPLICED_MACRO(s.den);
+}
+
+int main(void)
+{
+    Spliced s = (Spliced) { 1,\
+ 2 };
+
+    return spliced_function(s) + s.d\
+en + (str[0] == chr) + 0x1\
+0;
+}